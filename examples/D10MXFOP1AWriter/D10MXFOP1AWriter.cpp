@@ -387,6 +387,7 @@ HeaderMetadata* D10MXFOP1AWriter::CreateHeaderMetadata()
     if (!mDataModel)
         CreateDataModel();
     mHeaderMetadata = new HeaderMetadata(mDataModel);
+    mHeaderMetadata->enableWriteCache(); // only the sets with duration change when re-written in CompleteFile
 
     // Preface
     Preface *preface = new Preface(mHeaderMetadata);
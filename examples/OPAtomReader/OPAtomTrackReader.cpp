@@ -167,11 +167,11 @@ OPAtomTrackReader::OPAtomTrackReader(string filename, File *file)
         SourcePackage *fsp = 0;
         size_t i;
         for (i = 0; i < packages.size(); i++) {
-            fsp = dynamic_cast<SourcePackage*>(packages[i]);
+            fsp = metadata_set_cast<SourcePackage>(packages[i]);
             if (!fsp || !fsp->haveDescriptor())
                 continue;
 
-            file_descriptor = dynamic_cast<FileDescriptor*>(fsp->getDescriptor());
+            file_descriptor = metadata_set_cast<FileDescriptor>(fsp->getDescriptor());
             if (file_descriptor)
                 break;
         }
@@ -179,47 +179,25 @@ OPAtomTrackReader::OPAtomTrackReader(string filename, File *file)
             throw OP_ATOM_NO_FILE_PACKAGE;
 
         // get the material track info
+        // the track's source clip is matched on the package UMID only as the SourceTrackID may not be set
         Track *mp_track = 0;
-        for (i = 0; i < packages.size(); i++) {
-            MaterialPackage *mp = dynamic_cast<MaterialPackage*>(packages[i]);
-            if (!mp)
+        mxfUMID fsp_umid = fsp->getPackageUID();
+        const vector<PackageGraph::MaterialTrackChain> &chains =
+            header_metadata->getPackageGraph()->getMaterialTrackChains();
+        for (i = 0; i < chains.size(); i++) {
+            if (!chains[i].sourceClip ||
+                (chains[i].fileSourcePackage != fsp && chains[i].sourceClip->getSourcePackageID() != fsp_umid))
+            {
                 continue;
-
-            vector<GenericTrack*> tracks = mp->getTracks();
-            size_t j;
-            for (j = 0; j < tracks.size(); j++) {
-                Track *track = dynamic_cast<Track*>(tracks[j]);
-                if (!track)
-                    continue;
-
-                StructuralComponent *track_sequence = track->getSequence();
-
-                Sequence *sequence = dynamic_cast<Sequence*>(track_sequence);
-                SourceClip *source_clip = dynamic_cast<SourceClip*>(track_sequence);
-                if (sequence) {
-                    vector<StructuralComponent*> components = sequence->getStructuralComponents();
-                    if (components.size() != 1)
-                        continue;
-
-                    source_clip = dynamic_cast<SourceClip*>(components[0]);
-                }
-
-                if (!source_clip)
-                    continue;
-
-                mxfUMID fsp_umid = fsp->getPackageUID();
-                mxfUMID sc_umid = source_clip->getSourcePackageID();
-                if (memcmp(&fsp_umid, &sc_umid, sizeof(fsp_umid)) == 0) {
-                    mp_track = track;
-                    edit_rate = mp_track->getEditRate();
-                    mTrackId = mp_track->getTrackID();
-                    mDurationInMetadata = source_clip->getDuration();
-                    break;
-                }
             }
 
-            if (mp_track)
+            mp_track = metadata_set_cast<Track>(chains[i].materialTrack);
+            if (mp_track) {
+                edit_rate = mp_track->getEditRate();
+                mTrackId = mp_track->getTrackID();
+                mDurationInMetadata = chains[i].sourceClip->getDuration();
                 break;
+            }
         }
         if (!mp_track)
             throw OP_ATOM_HEADER_ERROR;
@@ -65,12 +65,23 @@ void AvidHeaderMetadata::createDefaultDictionary(Preface *preface)
     MXFPP_CHECK(mxf_avid_create_default_dictionary(getCHeaderMetadata(), &dictSet));
 
     MXFPP_CHECK(mxf_set_strongref_item(preface->getCMetadataSet(), &MXF_ITEM_K(Preface, Dictionary), dictSet));
+    preface->markModified();
 }
 
 void AvidHeaderMetadata::read(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len)
 {
+    markModified();
     MXFPP_CHECK(mxf_avid_read_filtered_header_metadata(file->getCFile(), 0, getCHeaderMetadata(),
                                                        partition->getCPartition()->headerByteCount, key, llen, len));
+    updateReadEndBytes(0);
+}
+
+void AvidHeaderMetadata::readParallel(File *file, Partition *partition, const mxfKey *key, uint8_t llen,
+                                      uint64_t len, unsigned int numThreads)
+{
+    (void)numThreads;
+
+    read(file, partition, key, llen, len);
 }
 
 void AvidHeaderMetadata::write(File *file, Partition *partition, FillerWriter *filler)
@@ -55,6 +55,10 @@ public:
 
     virtual void read(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len);
 
+    // the Avid meta-dictionary requires the sequential filtered read and so this calls read()
+    virtual void readParallel(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len,
+                              unsigned int numThreads = 0);
+
     virtual void write(File *file, Partition *partition, FillerWriter *filler);
 
 };
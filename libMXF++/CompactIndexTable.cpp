@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+
+static uint8_t get_bit_width(uint64_t value)
+{
+    uint8_t width = 0;
+    while (value) {
+        width++;
+        value >>= 1;
+    }
+    return width;
+}
+
+
+
+CompactIndexTable::CompactIndexTable()
+: _numEntries(0), _bitPosition(0)
+{
+    _pendingStreamOffsets.reserve(BLOCK_SIZE);
+    _pendingCodes.reserve(BLOCK_SIZE);
+}
+
+CompactIndexTable::~CompactIndexTable()
+{
+}
+
+void CompactIndexTable::appendEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags,
+                                    uint64_t streamOffset)
+{
+    _pendingStreamOffsets.push_back(streamOffset);
+    _pendingCodes.push_back(getAttributeCode(temporalOffset, keyFrameOffset, flags));
+    _numEntries++;
+
+    if (_pendingStreamOffsets.size() == BLOCK_SIZE)
+        encodeBlock();
+}
+
+void CompactIndexTable::appendEntries(const IndexTableSegment *segment)
+{
+    const ::MXFIndexEntry *cEntry;
+    for (cEntry = segment->_cSegment->indexEntryArray; cEntry; cEntry = cEntry->next)
+        appendEntry(cEntry->temporalOffset, cEntry->keyFrameOffset, cEntry->flags, cEntry->streamOffset);
+
+    size_t i;
+    for (i = 0; i < segment->_bulkStreamOffsets.size(); i++) {
+        appendEntry(segment->_bulkTemporalOffsets[i], segment->_bulkKeyFrameOffsets[i], segment->_bulkFlags[i],
+                    segment->_bulkStreamOffsets[i]);
+    }
+}
+
+bool CompactIndexTable::getEntry(int64_t position, int8_t *temporalOffset, int8_t *keyFrameOffset, uint8_t *flags,
+                                 uint64_t *streamOffset) const
+{
+    if (position < 0 || position >= _numEntries)
+        return false;
+
+    size_t block = (size_t)(position / BLOCK_SIZE);
+    uint32_t offset = (uint32_t)(position % BLOCK_SIZE);
+    if (block >= _anchors.size()) {
+        *streamOffset = _pendingStreamOffsets[offset];
+        decodeAttributes(_attributes[_pendingCodes[offset]], temporalOffset, keyFrameOffset, flags);
+        return true;
+    }
+
+    const BlockAnchor &anchor = _anchors[block];
+    *streamOffset = anchor.baseStreamOffset + (uint64_t)offset * anchor.minEditUnitSize +
+                        readBits(anchor.bitPosition + (uint64_t)offset * anchor.offsetBits, anchor.offsetBits);
+    uint32_t code = (uint32_t)readBits(anchor.bitPosition + (uint64_t)BLOCK_SIZE * anchor.offsetBits +
+                                           (uint64_t)offset * anchor.attributeBits,
+                                       anchor.attributeBits);
+    decodeAttributes(_attributes[code], temporalOffset, keyFrameOffset, flags);
+
+    return true;
+}
+
+uint64_t CompactIndexTable::getStreamOffset(int64_t position) const
+{
+    MXFPP_CHECK(position >= 0 && position < _numEntries);
+
+    size_t block = (size_t)(position / BLOCK_SIZE);
+    uint32_t offset = (uint32_t)(position % BLOCK_SIZE);
+    if (block >= _anchors.size())
+        return _pendingStreamOffsets[offset];
+
+    const BlockAnchor &anchor = _anchors[block];
+    return anchor.baseStreamOffset + (uint64_t)offset * anchor.minEditUnitSize +
+               readBits(anchor.bitPosition + (uint64_t)offset * anchor.offsetBits, anchor.offsetBits);
+}
+
+void CompactIndexTable::shrinkToFit()
+{
+    vector<BlockAnchor>(_anchors).swap(_anchors);
+    vector<uint64_t>(_bits).swap(_bits);
+    vector<uint32_t>(_attributes).swap(_attributes);
+}
+
+size_t CompactIndexTable::getMemorySize() const
+{
+    return sizeof(*this) +
+           _anchors.capacity() * sizeof(BlockAnchor) +
+           _bits.capacity() * sizeof(uint64_t) +
+           _attributes.capacity() * sizeof(uint32_t) +
+           _attributeCodes.size() * (sizeof(uint32_t) * 2 + sizeof(void*) * 2) +
+           _attributeCodes.bucket_count() * sizeof(void*) +
+           _pendingStreamOffsets.capacity() * sizeof(uint64_t) +
+           _pendingCodes.capacity() * sizeof(uint32_t);
+}
+
+void CompactIndexTable::encodeBlock()
+{
+    size_t count = _pendingStreamOffsets.size();
+    size_t i;
+
+    // the minimum edit unit size is used if the stream offsets are increasing
+    uint64_t min_size = 0xffffffffULL;
+    for (i = 1; i < count; i++) {
+        if (_pendingStreamOffsets[i] < _pendingStreamOffsets[i - 1]) {
+            min_size = 0;
+            break;
+        }
+        if (_pendingStreamOffsets[i] - _pendingStreamOffsets[i - 1] < min_size)
+            min_size = _pendingStreamOffsets[i] - _pendingStreamOffsets[i - 1];
+    }
+    if (count <= 1)
+        min_size = 0;
+
+    uint64_t base = _pendingStreamOffsets[0];
+    for (i = 1; i < count; i++) {
+        if (_pendingStreamOffsets[i] - i * min_size < base)
+            base = _pendingStreamOffsets[i] - i * min_size;
+    }
+
+    uint64_t max_residual = 0;
+    uint32_t max_code = 0;
+    for (i = 0; i < count; i++) {
+        uint64_t residual = _pendingStreamOffsets[i] - i * min_size - base;
+        if (residual > max_residual)
+            max_residual = residual;
+        if (_pendingCodes[i] > max_code)
+            max_code = _pendingCodes[i];
+    }
+
+    BlockAnchor anchor;
+    anchor.baseStreamOffset = base;
+    anchor.bitPosition = _bitPosition;
+    anchor.minEditUnitSize = (uint32_t)min_size;
+    anchor.offsetBits = get_bit_width(max_residual);
+    anchor.attributeBits = get_bit_width(max_code);
+    _anchors.push_back(anchor);
+
+    for (i = 0; i < count; i++)
+        appendBits(_pendingStreamOffsets[i] - i * min_size - base, anchor.offsetBits);
+    for (i = 0; i < count; i++)
+        appendBits(_pendingCodes[i], anchor.attributeBits);
+
+    _pendingStreamOffsets.clear();
+    _pendingCodes.clear();
+}
+
+uint32_t CompactIndexTable::getAttributeCode(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags)
+{
+    uint32_t attributes = (uint32_t)(uint8_t)temporalOffset |
+                          ((uint32_t)(uint8_t)keyFrameOffset << 8) |
+                          ((uint32_t)flags << 16);
+
+    unordered_map<uint32_t, uint32_t>::const_iterator iter = _attributeCodes.find(attributes);
+    if (iter != _attributeCodes.end())
+        return iter->second;
+
+    uint32_t code = (uint32_t)_attributes.size();
+    _attributes.push_back(attributes);
+    _attributeCodes[attributes] = code;
+    return code;
+}
+
+void CompactIndexTable::appendBits(uint64_t value, uint8_t numBits)
+{
+    if (numBits == 0)
+        return;
+
+    uint32_t shift = (uint32_t)(_bitPosition & 63);
+    if (shift == 0)
+        _bits.push_back(0);
+    _bits.back() |= value << shift;
+    if (shift + numBits > 64)
+        _bits.push_back(value >> (64 - shift));
+
+    _bitPosition += numBits;
+}
+
+uint64_t CompactIndexTable::readBits(uint64_t bitPosition, uint8_t numBits) const
+{
+    if (numBits == 0)
+        return 0;
+
+    size_t word = (size_t)(bitPosition >> 6);
+    uint32_t shift = (uint32_t)(bitPosition & 63);
+    uint64_t value = _bits[word] >> shift;
+    if (shift + numBits > 64)
+        value |= _bits[word + 1] << (64 - shift);
+
+    if (numBits < 64)
+        value &= (1ULL << numBits) - 1;
+
+    return value;
+}
+
+void CompactIndexTable::decodeAttributes(uint32_t attributes, int8_t *temporalOffset, int8_t *keyFrameOffset,
+                                         uint8_t *flags) const
+{
+    *temporalOffset = (int8_t)(uint8_t)(attributes & 0xff);
+    *keyFrameOffset = (int8_t)(uint8_t)((attributes >> 8) & 0xff);
+    *flags = (uint8_t)((attributes >> 16) & 0xff);
+}
+
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_COMPACT_INDEX_TABLE_H_
+#define MXFPP_COMPACT_INDEX_TABLE_H_
+
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+class IndexTableSegment;
+
+// a read-only compressed store of VBR index entries for long files. Entries are grouped into blocks of
+// BLOCK_SIZE, each with an anchor holding the block's base stream offset and bit widths. The stream offsets
+// are stored as bit-packed residuals from a linear prediction using the block's minimum edit unit size and
+// the (temporal offset, key frame offset, flags) combinations are stored as bit-packed dictionary codes
+class CompactIndexTable
+{
+public:
+    static const uint32_t BLOCK_SIZE = 64;
+
+public:
+    CompactIndexTable();
+    ~CompactIndexTable();
+
+    void appendEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags, uint64_t streamOffset);
+    void appendEntries(const IndexTableSegment *segment);
+
+    int64_t getNumEntries() const { return _numEntries; }
+
+    bool getEntry(int64_t position, int8_t *temporalOffset, int8_t *keyFrameOffset, uint8_t *flags,
+                  uint64_t *streamOffset) const;
+    uint64_t getStreamOffset(int64_t position) const;
+
+    // releases unused capacity once all entries have been appended
+    void shrinkToFit();
+
+    size_t getMemorySize() const;
+
+private:
+    typedef struct
+    {
+        uint64_t baseStreamOffset;
+        uint64_t bitPosition;
+        uint32_t minEditUnitSize;
+        uint8_t offsetBits;
+        uint8_t attributeBits;
+    } BlockAnchor;
+
+    void encodeBlock();
+    uint32_t getAttributeCode(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags);
+    void appendBits(uint64_t value, uint8_t numBits);
+    uint64_t readBits(uint64_t bitPosition, uint8_t numBits) const;
+    void decodeAttributes(uint32_t attributes, int8_t *temporalOffset, int8_t *keyFrameOffset,
+                          uint8_t *flags) const;
+
+private:
+    int64_t _numEntries;
+    std::vector<BlockAnchor> _anchors;
+    std::vector<uint64_t> _bits;
+    uint64_t _bitPosition;
+
+    std::vector<uint32_t> _attributes;
+    std::unordered_map<uint32_t, uint32_t> _attributeCodes;
+
+    std::vector<uint64_t> _pendingStreamOffsets;
+    std::vector<uint32_t> _pendingCodes;
+};
+
+
+};
+
+
+
+#endif
+
@@ -33,12 +33,331 @@
 #include "config.h"
 #endif
 
+#include <cstring>
+#include <algorithm>
+
+#include <memory>
+#include <thread>
+
 #include <libMXF++/MXF.h>
 
 using namespace std;
 using namespace mxfpp;
 
 
+// headers with fewer sets are decoded by the calling thread only
+#define MIN_PARALLEL_READ_SETS      512
+
+
+typedef struct
+{
+    mxfKey key;
+    uint64_t valueOffset;
+    uint64_t len;
+} HeaderSetKLV;
+
+
+// Utility class to hold the sets decoded by HeaderSetReader that have not yet been added to the header metadata
+class DecodedSetList
+{
+public:
+    DecodedSetList(size_t size)
+    : _cSets(size, (::MXFMetadataSet*)0)
+    {
+    }
+
+    ~DecodedSetList()
+    {
+        size_t i;
+        for (i = 0; i < _cSets.size(); i++)
+        {
+            if (_cSets[i])
+            {
+                mxf_free_set(&_cSets[i]);
+            }
+        }
+    }
+
+    ::MXFMetadataSet*& operator[](size_t index) { return _cSets[index]; }
+    size_t size() const { return _cSets.size(); }
+
+private:
+    vector< ::MXFMetadataSet*> _cSets;
+};
+
+
+// Decodes a contiguous range of sets from the header metadata bytes held in memory
+class HeaderSetReader
+{
+public:
+    HeaderSetReader()
+    {
+        _cHeaderMetadata = 0;
+        _data = 0;
+        _size = 0;
+        _klvs = 0;
+        _cSets = 0;
+        _begin = 0;
+        _end = 0;
+        _failed = false;
+    }
+
+    void init(::MXFHeaderMetadata *cHeaderMetadata, const unsigned char *data, uint64_t size,
+              const vector<HeaderSetKLV> *klvs, DecodedSetList *cSets, size_t begin, size_t end)
+    {
+        _cHeaderMetadata = cHeaderMetadata;
+        _data = data;
+        _size = size;
+        _klvs = klvs;
+        _cSets = cSets;
+        _begin = begin;
+        _end = end;
+    }
+
+    void read()
+    {
+        ::MXFMemoryFile *cMemFile = 0;
+        ::MXFFile *cFile = 0;
+        try
+        {
+            MXFPP_CHECK(mxf_mem_file_open_read(_data, _size, 0, &cMemFile));
+            cFile = mxf_mem_file_get_file(cMemFile);
+
+            ::MXFSetDef *setDef;
+            size_t i;
+            for (i = _begin; i < _end; i++)
+            {
+                const HeaderSetKLV &klv = (*_klvs)[i];
+
+                // sets with an unknown definition are skipped, as is done by mxf_read_header_metadata
+                if (!mxf_find_set_def(_cHeaderMetadata->dataModel, &klv.key, &setDef))
+                    continue;
+
+                MXFPP_CHECK(mxf_file_seek(cFile, klv.valueOffset, SEEK_SET));
+                MXFPP_CHECK(mxf_read_and_return_set(cFile, &klv.key, klv.len, _cHeaderMetadata, 0,
+                                                    &(*_cSets)[i]));
+            }
+        }
+        catch (...)
+        {
+            _failed = true;
+        }
+
+        if (cFile)
+        {
+            mxf_file_close(&cFile);
+        }
+    }
+
+    bool failed() const { return _failed; }
+
+private:
+    ::MXFHeaderMetadata *_cHeaderMetadata;
+    const unsigned char *_data;
+    uint64_t _size;
+    const vector<HeaderSetKLV> *_klvs;
+    DecodedSetList *_cSets;
+    size_t _begin;
+    size_t _end;
+    bool _failed;
+};
+
+
+
+// Utility class that encodes header metadata into memory
+class MemoryEncoder
+{
+public:
+    MemoryEncoder(uint8_t minLLen)
+    {
+        MXFPP_CHECK(mxf_mem_file_open_new(8192, 0, &_cMemFile));
+        _file = new File(mxf_mem_file_get_file(_cMemFile));
+        _file->setMinLLen(minLLen);
+    }
+
+    ~MemoryEncoder()
+    {
+        delete _file;
+    }
+
+    ::MXFFile* getCFile()
+    {
+        return _file->getCFile();
+    }
+
+    File* getFile()
+    {
+        return _file;
+    }
+
+    void reset()
+    {
+        MXFPP_CHECK(mxf_file_seek(getCFile(), 0, SEEK_SET));
+    }
+
+    // copies the bytes written since construction or the last reset
+    void getData(vector<unsigned char> *data)
+    {
+        int64_t size = mxf_file_tell(getCFile());
+        data->resize((size_t)size);
+
+        int64_t offset = 0;
+        int64_t numChunks = mxf_mem_file_get_num_chunks(_cMemFile);
+        int64_t i;
+        for (i = 0; i < numChunks && offset < size; i++)
+        {
+            int64_t chunkSize = mxf_mem_file_get_chunk_size(_cMemFile, i);
+            if (chunkSize > size - offset)
+            {
+                chunkSize = size - offset;
+            }
+            memcpy(&(*data)[(size_t)offset], mxf_mem_file_get_chunk_data(_cMemFile, i), (size_t)chunkSize);
+            offset += chunkSize;
+        }
+        MXFPP_CHECK(offset == size);
+    }
+
+private:
+    ::MXFMemoryFile *_cMemFile;
+    File *_file;
+};
+
+
+
+static bool read_ber_length(const unsigned char *data, uint64_t size, uint8_t *llen, uint64_t *len)
+{
+    if (size == 0)
+        return false;
+
+    if (data[0] < 0x80)
+    {
+        *llen = 1;
+        *len = data[0];
+        return true;
+    }
+
+    uint8_t numBytes = data[0] & 0x7f;
+    if (numBytes == 0 || numBytes > 8 || size < (uint64_t)numBytes + 1)
+        return false;
+
+    uint64_t value = 0;
+    uint8_t i;
+    for (i = 1; i <= numBytes; i++)
+    {
+        value = (value << 8) | data[i];
+    }
+
+    *llen = numBytes + 1;
+    *len = value;
+    return true;
+}
+
+static void find_header_set_klvs(const unsigned char *data, uint64_t size, vector<HeaderSetKLV> *klvs)
+{
+    HeaderSetKLV klv;
+    uint8_t llen;
+    uint64_t offset = 0;
+    while (offset < size)
+    {
+        MXFPP_CHECK(size - offset > mxfKey_extlen);
+        memcpy(&klv.key, &data[offset], mxfKey_extlen);
+        offset += mxfKey_extlen;
+
+        MXFPP_CHECK(read_ber_length(&data[offset], size - offset, &llen, &klv.len));
+        offset += llen;
+        MXFPP_CHECK(klv.len <= size - offset);
+
+        if (!mxf_is_filler(&klv.key))
+        {
+            klv.valueOffset = offset;
+            klvs->push_back(klv);
+        }
+        offset += klv.len;
+    }
+}
+
+
+
+typedef enum
+{
+    NOT_REF_ITEM,
+    REF_ITEM,
+    REF_ARRAY_ITEM
+} RefItemType;
+
+static bool is_ref_type(::MXFItemType *itemType)
+{
+    return itemType && (itemType->typeId == MXF_STRONGREF_TYPE || itemType->typeId == MXF_WEAKREF_TYPE);
+}
+
+static RefItemType get_ref_item_type(::MXFDataModel *dataModel, const mxfKey *itemKey)
+{
+    ::MXFItemDef *itemDef;
+    if (!mxf_find_item_def(dataModel, itemKey, &itemDef))
+        return NOT_REF_ITEM;
+
+    ::MXFItemType *itemType = mxf_get_item_def_type(dataModel, itemDef->typeId);
+    if (is_ref_type(itemType))
+        return REF_ITEM;
+    if (itemType && itemType->category == MXF_ARRAY_TYPE_CAT &&
+        is_ref_type(mxf_get_item_def_type(dataModel, itemType->info.array.elementTypeId)))
+    {
+        return REF_ARRAY_ITEM;
+    }
+
+    return NOT_REF_ITEM;
+}
+
+static void remap_uuid(uint8_t *value, const unordered_map<mxfUUID, mxfUUID> &uuidMap)
+{
+    mxfUUID uuid;
+    mxf_get_uuid(value, &uuid);
+
+    unordered_map<mxfUUID, mxfUUID>::const_iterator iter = uuidMap.find(uuid);
+    if (iter != uuidMap.end())
+        mxf_set_uuid(&iter->second, value);
+}
+
+
+
+static void count_c_header_metadata(::MXFHeaderMetadata *cHeaderMetadata, HeaderMetadata::MemoryStats *stats)
+{
+    static const size_t LIST_ELEMENT_SIZE = sizeof(::MXFListElement);
+
+    stats->setCount = 0;
+    stats->setCountByKey.clear();
+    stats->itemCount = 0;
+    stats->itemValueBytes = 0;
+    stats->cStructureBytes = sizeof(::MXFHeaderMetadata);
+
+    ::MXFListIterator iter;
+    mxf_initialise_list_iter(&iter, &cHeaderMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        ::MXFMetadataSet *cSet = (::MXFMetadataSet*)mxf_get_iter_element(&iter);
+        stats->setCount++;
+        stats->setCountByKey[cSet->key]++;
+        stats->cStructureBytes += sizeof(::MXFMetadataSet) + LIST_ELEMENT_SIZE;
+
+        ::MXFListIterator itemIter;
+        mxf_initialise_list_iter(&itemIter, &cSet->items);
+        while (mxf_next_list_iter_element(&itemIter))
+        {
+            ::MXFMetadataItem *item = (::MXFMetadataItem*)mxf_get_iter_element(&itemIter);
+            stats->itemCount++;
+            stats->itemValueBytes += item->length;
+            stats->cStructureBytes += sizeof(::MXFMetadataItem) + LIST_ELEMENT_SIZE;
+        }
+    }
+
+    if (cHeaderMetadata->primerPack)
+    {
+        stats->cStructureBytes += sizeof(::MXFPrimerPack) + mxf_get_list_length(&cHeaderMetadata->primerPack->entries) *
+                                      (sizeof(mxfUID) + sizeof(mxfLocalTag) + LIST_ELEMENT_SIZE);
+    }
+}
+
+
 
 bool HeaderMetadata::isHeaderMetadata(const mxfKey *key)
 {
@@ -49,6 +368,17 @@ HeaderMetadata::HeaderMetadata(DataModel *dataModel)
 {
     _initGenerationUID = false;
     _generationUID = g_Null_UUID;
+    _arena = 0;
+    _writeCacheEnabled = false;
+    _primerPackBytesPack = 0;
+    _primerPackBytesEntryCount = 0;
+    _primerPackBytesLLen = 0;
+    _wrapperGeneration = 0;
+    _modificationCount = 0;
+    _frozen = false;
+    _readEndBytes = 0;
+    _packageGraph = 0;
+    _packageGraphModificationCount = 0;
 
     initialiseObjectFactory();
     MXFPP_CHECK(mxf_create_header_metadata(&_cHeaderMetadata, dataModel->getCDataModel()));
@@ -59,6 +389,20 @@ HeaderMetadata::HeaderMetadata(DataModel *dataModel)
 
 HeaderMetadata::HeaderMetadata(::MXFHeaderMetadata *c_header_metadata, bool take_ownership)
 {
+    _initGenerationUID = false;
+    _generationUID = g_Null_UUID;
+    _arena = 0;
+    _writeCacheEnabled = false;
+    _primerPackBytesPack = 0;
+    _primerPackBytesEntryCount = 0;
+    _primerPackBytesLLen = 0;
+    _wrapperGeneration = 0;
+    _modificationCount = 0;
+    _frozen = false;
+    _readEndBytes = 0;
+    _packageGraph = 0;
+    _packageGraphModificationCount = 0;
+
     initialiseObjectFactory();
     _cHeaderMetadata = c_header_metadata;
     _ownCHeaderMetadata = take_ownership;
@@ -68,25 +412,29 @@ HeaderMetadata::HeaderMetadata(::MXFHeaderMetadata *c_header_metadata, bool take
 
 HeaderMetadata::~HeaderMetadata()
 {
-    map<mxfKey, AbsMetadataSetFactory*>::iterator iter1;
+    ObjectFactory::iterator iter1;
     for (iter1 = _objectFactory.begin(); iter1 != _objectFactory.end(); iter1++)
     {
         delete (*iter1).second;
     }
 
-    map<mxfUUID, MetadataSet*>::iterator iter2;
+    ObjectDirectory::iterator iter2;
     for (iter2 = _objectDirectory.begin(); iter2 != _objectDirectory.end(); iter2++)
     {
         (*iter2).second->_headerMetadata = 0; // break containment link
         delete (*iter2).second;
     }
+    // release the directory's nodes and buckets now because they are allocated from the arena deleted below
+    ObjectDirectory().swap(_objectDirectory);
 
     if (_ownCHeaderMetadata)
     {
         mxf_free_header_metadata(&_cHeaderMetadata);
     }
 
+    delete _packageGraph;
     delete _dataModel;
+    delete _arena;
 }
 
 mxfProductVersion HeaderMetadata::getToolkitVersion()
@@ -113,7 +461,7 @@ void HeaderMetadata::disableGenerationUIDInit()
 
 void HeaderMetadata::registerObjectFactory(const mxfKey *key, AbsMetadataSetFactory *factory)
 {
-    pair<map<mxfKey, AbsMetadataSetFactory*>::iterator, bool> result =
+    pair<ObjectFactory::iterator, bool> result =
         _objectFactory.insert(pair<mxfKey, AbsMetadataSetFactory*>(*key, factory));
     if (result.second == false)
     {
@@ -123,29 +471,232 @@ void HeaderMetadata::registerObjectFactory(const mxfKey *key, AbsMetadataSetFact
     }
 }
 
+void HeaderMetadata::enableWriteCache(bool enable)
+{
+    _writeCacheEnabled = enable;
+    if (!enable)
+    {
+        _primerPackBytes.clear();
+        _primerPackBytesPack = 0;
+
+        ObjectDirectory::iterator iter;
+        for (iter = _objectDirectory.begin(); iter != _objectDirectory.end(); iter++)
+        {
+            vector<unsigned char>().swap((*iter).second->_encodedBytes);
+        }
+    }
+}
+
+void HeaderMetadata::registerPatchItem(MetadataSet *set, const mxfKey *itemKey)
+{
+    MXFPP_CHECK(set->getHeaderMetadata() == this);
+    MXFPP_CHECK(set->haveItem(itemKey));
+
+    PatchItem patchItem;
+    patchItem.set = set;
+    patchItem.itemKey = *itemKey;
+    patchItem.fileOffset = -1;
+    _patchItems.push_back(patchItem);
+}
+
+void HeaderMetadata::clearPatchItems()
+{
+    _patchItems.clear();
+}
+
+void HeaderMetadata::patchItems(File *file)
+{
+    // check all items before writing so that the file is left unchanged if an item can't be patched
+    vector< ::MXFMetadataItem*> cItems(_patchItems.size());
+    size_t i;
+    for (i = 0; i < _patchItems.size(); i++)
+    {
+        PatchItem &patchItem = _patchItems[i];
+        if (patchItem.fileOffset < 0)
+        {
+            throw MXFException("Header metadata item to patch has not been written");
+        }
+
+        if (!mxf_get_item(patchItem.set->getCMetadataSet(), &patchItem.itemKey, &cItems[i]))
+        {
+            throw MXFException("Header metadata item to patch has been removed");
+        }
+        if (cItems[i]->length != patchItem.writtenValue.size())
+        {
+            throw MXFException("Header metadata item to patch has changed size from %u to %u",
+                               (unsigned int)patchItem.writtenValue.size(), cItems[i]->length);
+        }
+    }
+
+    int64_t originalPos = -1;
+    for (i = 0; i < _patchItems.size(); i++)
+    {
+        PatchItem &patchItem = _patchItems[i];
+        ::MXFMetadataItem *cItem = cItems[i];
+        if (cItem->length == 0 || memcmp(cItem->value, &patchItem.writtenValue[0], cItem->length) == 0)
+            continue;
+
+        if (originalPos < 0)
+            originalPos = file->tell();
+        file->seek(patchItem.fileOffset, SEEK_SET);
+        MXFPP_CHECK(file->write(cItem->value, cItem->length) == cItem->length);
+        memcpy(&patchItem.writtenValue[0], cItem->value, cItem->length);
+    }
+
+    if (originalPos >= 0)
+        file->seek(originalPos, SEEK_SET);
+}
+
 void HeaderMetadata::registerPrimerEntry(const mxfUID *itemKey, mxfLocalTag newTag, mxfLocalTag *assignedTag)
 {
     MXFPP_CHECK(mxf_register_primer_entry(_cHeaderMetadata->primerPack, itemKey, newTag, assignedTag));
 }
 
+void HeaderMetadata::enableArenaAllocation(size_t blockSize)
+{
+    MXFPP_CHECK(!_arena);
+    MXFPP_CHECK(_objectDirectory.empty());
+
+    _arena = new MemoryArena(blockSize);
+    _objectDirectory = ObjectDirectory(0, hash<mxfUUID>(), equal_to<mxfUUID>(),
+                                       ArenaAllocator<pair<const mxfUUID, MetadataSet*> >(_arena));
+}
+
 void HeaderMetadata::read(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len)
 {
+    markModified();
     MXFPP_CHECK(mxf_read_header_metadata(file->getCFile(), _cHeaderMetadata,
                                          partition->getCPartition()->headerByteCount, key, llen, len));
+    updateReadEndBytes(0);
 }
 
 void HeaderMetadata::readFiltered(File *file, Partition *partition, MXFReadFilter *filter, const mxfKey *key, uint8_t llen, uint64_t len) {
+    markModified();
     MXFPP_CHECK(mxf_read_filtered_header_metadata(file->getCFile(), filter, _cHeaderMetadata,
                                          partition->getCPartition()->headerByteCount, key, llen, len));
+    updateReadEndBytes(0);
+}
+
+void HeaderMetadata::readParallel(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len,
+                                  unsigned int numThreads)
+{
+    MXFPP_CHECK(mxf_is_primer_pack(key));
+
+    uint64_t headerByteCount = partition->getCPartition()->headerByteCount;
+    uint64_t count = mxfKey_extlen + llen + len;
+    uint64_t setsSize = 0;
+    if (headerByteCount > count)
+    {
+        setsSize = headerByteCount - count;
+    }
+    if (setsSize > (uint32_t)(-1))
+    {
+        read(file, partition, key, llen, len);
+        return;
+    }
+
+    markModified();
+
+    mxf_free_primer_pack(&_cHeaderMetadata->primerPack);
+    MXFPP_CHECK(mxf_read_primer_pack(file->getCFile(), &_cHeaderMetadata->primerPack));
+
+    // read the remainder of the header metadata into memory
+    vector<unsigned char> data((size_t)setsSize);
+    if (setsSize > 0)
+    {
+        MXFPP_CHECK(file->read(&data[0], (uint32_t)setsSize) == setsSize);
+    }
+
+    vector<HeaderSetKLV> klvs;
+    find_header_set_klvs(data.empty() ? 0 : &data[0], setsSize, &klvs);
+    if (klvs.empty())
+    {
+        return;
+    }
+
+
+    // decode the sets, with each thread decoding a contiguous range of sets
+
+    if (numThreads == 0)
+    {
+        numThreads = thread::hardware_concurrency();
+    }
+    if (numThreads == 0 || klvs.size() < MIN_PARALLEL_READ_SETS)
+    {
+        numThreads = 1;
+    }
+    else if (numThreads > klvs.size() / (MIN_PARALLEL_READ_SETS / 4))
+    {
+        numThreads = (unsigned int)(klvs.size() / (MIN_PARALLEL_READ_SETS / 4));
+    }
+
+    DecodedSetList cSets(klvs.size());
+    vector<HeaderSetReader> readers(numThreads);
+    vector<thread> threads;
+    size_t begin = 0;
+    size_t end;
+    unsigned int i;
+    for (i = 0; i < numThreads; i++)
+    {
+        end = begin + (klvs.size() - begin) / (numThreads - i);
+        readers[i].init(_cHeaderMetadata, &data[0], setsSize, &klvs, &cSets, begin, end);
+        begin = end;
+    }
+
+    for (i = 1; i < numThreads; i++)
+    {
+        threads.push_back(thread(&HeaderSetReader::read, &readers[i]));
+    }
+    readers[0].read();
+    for (i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    for (i = 0; i < numThreads; i++)
+    {
+        if (readers[i].failed())
+        {
+            throw MXFException("Failed to read header metadata sets");
+        }
+    }
+
+
+    // add the sets in file order so that the result matches the serial read
+
+    size_t j;
+    for (j = 0; j < cSets.size(); j++)
+    {
+        if (cSets[j])
+        {
+            MXFPP_CHECK(mxf_add_set(_cHeaderMetadata, cSets[j]));
+            cSets[j] = 0;
+        }
+    }
+
+    updateReadEndBytes(data.capacity() + klvs.capacity() * sizeof(HeaderSetKLV) +
+                        cSets.size() * sizeof(::MXFMetadataSet*) + readers.capacity() * sizeof(HeaderSetReader));
 }
 
 void HeaderMetadata::write(File *file, Partition *partition, FillerWriter *filler)
 {
     partition->markHeaderStart(file);
 
-    MXFPP_CHECK(mxf_write_header_primer_pack(file->getCFile(), _cHeaderMetadata));
-    partition->fillToKag(file);
-    MXFPP_CHECK(mxf_write_header_sets(file->getCFile(), _cHeaderMetadata));
+    if (_writeCacheEnabled || !_patchItems.empty())
+    {
+        if (_writeCacheEnabled)
+            writeCachedPrimerPack(file);
+        else
+            MXFPP_CHECK(mxf_write_header_primer_pack(file->getCFile(), _cHeaderMetadata));
+        partition->fillToKag(file);
+        writeSets(file);
+    }
+    else
+    {
+        MXFPP_CHECK(mxf_write_header_primer_pack(file->getCFile(), _cHeaderMetadata));
+        partition->fillToKag(file);
+        MXFPP_CHECK(mxf_write_header_sets(file->getCFile(), _cHeaderMetadata));
+    }
     if (filler)
     {
         filler->write(file);
@@ -169,8 +720,196 @@ Preface* HeaderMetadata::getPreface()
     return dynamic_cast<Preface*>(wrap(cSet));
 }
 
+void HeaderMetadata::markModified()
+{
+    if (_frozen)
+        throw MXFException("Header metadata is frozen and cannot be modified");
+
+    _modificationCount++;
+}
+
+PackageGraph* HeaderMetadata::getPackageGraph()
+{
+    if (_frozen)
+    {
+        // freeze() only builds the graph if there is a content storage
+        if (!_packageGraph)
+            throw MXFException("Frozen header metadata has no content storage package graph");
+        return _packageGraph;
+    }
+
+    if (!_packageGraph || _packageGraphModificationCount != _modificationCount)
+    {
+        delete _packageGraph;
+        _packageGraph = 0;
+        _packageGraph = new PackageGraph(this);
+        _packageGraphModificationCount = _modificationCount;
+    }
+
+    return _packageGraph;
+}
+
+void HeaderMetadata::freeze()
+{
+    if (_frozen)
+        return;
+
+    vector<MetadataSet*> sets;
+    ::MXFListIterator iter;
+    mxf_initialise_list_iter(&iter, &_cHeaderMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+        sets.push_back(wrap((::MXFMetadataSet*)mxf_get_iter_element(&iter)));
+
+    size_t i;
+    for (i = 0; i < sets.size(); i++)
+    {
+        ::MXFListIterator itemIter;
+        mxf_initialise_list_iter(&itemIter, &sets[i]->getCMetadataSet()->items);
+        while (mxf_next_list_iter_element(&itemIter))
+        {
+            ::MXFMetadataItem *item = (::MXFMetadataItem*)mxf_get_iter_element(&itemIter);
+            if (get_ref_item_type(_cHeaderMetadata->dataModel, &item->key) == REF_ARRAY_ITEM)
+                sets[i]->dereferenceRefArrayItem(&item->key);
+        }
+
+        Sequence *sequence = metadata_set_cast<Sequence>(sets[i]);
+        if (sequence)
+            sequence->getStructuralComponentsDuration();
+    }
+
+    ::MXFMetadataSet *prefaceSet;
+    if (mxf_find_singular_set_by_key(_cHeaderMetadata, &MXF_SET_K(Preface), &prefaceSet) &&
+        mxf_have_item(prefaceSet, &MXF_ITEM_K(Preface, ContentStorage)))
+    {
+        getPackageGraph()->resolveAll();
+    }
+
+    _frozen = true;
+}
+
+void HeaderMetadata::cloneAll(HeaderMetadata *toHeaderMetadata, bool newInstanceUIDs) const
+{
+    MXFPP_CHECK(toHeaderMetadata != this);
+
+    toHeaderMetadata->markModified();
+
+    ::MXFHeaderMetadata *toCHeaderMetadata = toHeaderMetadata->getCHeaderMetadata();
+    ::MXFListIterator iter;
+
+    unordered_map<mxfUUID, mxfUUID> uuidMap;
+    if (newInstanceUIDs)
+    {
+        mxf_initialise_list_iter(&iter, &_cHeaderMetadata->sets);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            ::MXFMetadataSet *cSet = (::MXFMetadataSet*)mxf_get_iter_element(&iter);
+            mxf_generate_uuid(&uuidMap[cSet->instanceUID]);
+        }
+    }
+
+    unordered_map<mxfKey, RefItemType> refItemTypes;
+    unordered_map<mxfKey, RefItemType>::iterator refItemTypeIter;
+    vector<uint8_t> buffer;
+    mxf_initialise_list_iter(&iter, &_cHeaderMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        ::MXFMetadataSet *cSet = (::MXFMetadataSet*)mxf_get_iter_element(&iter);
+
+        ::MXFMetadataSet *toCSet;
+        MXFPP_CHECK(mxf_create_set(toCHeaderMetadata, &cSet->key, &toCSet));
+        toCSet->instanceUID = (newInstanceUIDs ? uuidMap[cSet->instanceUID] : cSet->instanceUID);
+        toCSet->fixedSpaceAllocation = cSet->fixedSpaceAllocation;
+
+        ::MXFListIterator itemIter;
+        mxf_initialise_list_iter(&itemIter, &cSet->items);
+        while (mxf_next_list_iter_element(&itemIter))
+        {
+            ::MXFMetadataItem *item = (::MXFMetadataItem*)mxf_get_iter_element(&itemIter);
+
+            if (!newInstanceUIDs)
+            {
+                MXFPP_CHECK(mxf_set_item(toCSet, &item->key, item->value, item->length));
+                continue;
+            }
+
+            RefItemType refItemType;
+            if (mxf_equals_key(&item->key, &MXF_ITEM_K(InterchangeObject, InstanceUID)))
+            {
+                refItemType = REF_ITEM;
+            }
+            else
+            {
+                refItemTypeIter = refItemTypes.find(item->key);
+                if (refItemTypeIter == refItemTypes.end())
+                {
+                    refItemTypeIter = refItemTypes.insert(
+                        make_pair(item->key, get_ref_item_type(_cHeaderMetadata->dataModel, &item->key))).first;
+                }
+                refItemType = refItemTypeIter->second;
+            }
+            if (refItemType == NOT_REF_ITEM || item->length == 0)
+            {
+                MXFPP_CHECK(mxf_set_item(toCSet, &item->key, item->value, item->length));
+                continue;
+            }
+
+            buffer.assign(item->value, item->value + item->length);
+            if (refItemType == REF_ITEM)
+            {
+                if (item->length == mxfUUID_extlen)
+                    remap_uuid(&buffer[0], uuidMap);
+            }
+            else if (item->length >= 8)
+            {
+                uint32_t count, elementLength;
+                mxf_get_uint32(&buffer[0], &count);
+                mxf_get_uint32(&buffer[4], &elementLength);
+                MXFPP_CHECK(elementLength == mxfUUID_extlen && 8 + (uint64_t)count * elementLength <= item->length);
+                uint32_t i;
+                for (i = 0; i < count; i++)
+                    remap_uuid(&buffer[8 + i * elementLength], uuidMap);
+            }
+            MXFPP_CHECK(mxf_set_item(toCSet, &item->key, &buffer[0], item->length));
+        }
+    }
+}
+
+void HeaderMetadata::getMemoryStats(MemoryStats *stats) const
+{
+    count_c_header_metadata(_cHeaderMetadata, stats);
+
+    stats->wrapperCount = _objectDirectory.size();
+    stats->wrapperBytes = 0;
+    stats->cacheBytes = _primerPackBytes.capacity();
+    ObjectDirectory::const_iterator iter;
+    for (iter = _objectDirectory.begin(); iter != _objectDirectory.end(); iter++)
+    {
+        stats->wrapperBytes += (*iter).second->getAllocationSize();
+        stats->cacheBytes += (*iter).second->getCacheSize();
+    }
+
+    // a node per entry with a next pointer and the cached hash, and a bucket array of pointers
+    stats->directoryBytes = _objectDirectory.size() *
+                                (sizeof(ObjectDirectory::value_type) + sizeof(void*) + sizeof(size_t)) +
+                            _objectDirectory.bucket_count() * sizeof(void*);
+
+    stats->arenaAllocatedBytes = (_arena ? _arena->getAllocatedSize() : 0);
+    stats->arenaReservedBytes = (_arena ? _arena->getReservedSize() : 0);
+    stats->readEndBytes = _readEndBytes;
+}
+
+void HeaderMetadata::updateReadEndBytes(size_t transientBytes)
+{
+    MemoryStats stats;
+    count_c_header_metadata(_cHeaderMetadata, &stats);
+    _readEndBytes = stats.cStructureBytes + stats.itemValueBytes + transientBytes;
+}
+
 void HeaderMetadata::add(MetadataSet *set)
 {
+    if (_frozen)
+        throw MXFException("Header metadata is frozen and cannot be modified");
+
     _objectDirectory.insert(pair<mxfUUID, MetadataSet*>(set->getCMetadataSet()->instanceUID, set));
     if (_initGenerationUID)
     {
@@ -199,7 +938,7 @@ MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
 
     MetadataSet *set = 0;
 
-    map<mxfUUID, MetadataSet*>::const_iterator objIter;
+    ObjectDirectory::const_iterator objIter;
     objIter = _objectDirectory.find(cMetadataSet->instanceUID);
     if (objIter != _objectDirectory.end())
     {
@@ -207,14 +946,19 @@ MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
 
         if (cMetadataSet != set->getCMetadataSet())
         {
+            if (_frozen)
+                throw MXFException("Header metadata is frozen and cannot be modified");
+
             mxf_log(MXF_WLOG, "Metadata set with same instance UUID found when creating "
                 "C++ object. Changing wrapped C metadata set.");
             set->_cMetadataSet = cMetadataSet;
+            set->markModified();
+            _wrapperGeneration++;
         }
     }
     else
     {
-        map<mxfKey, AbsMetadataSetFactory*>::iterator iter;
+        ObjectFactory::iterator iter;
 
         ::MXFSetDef *setDef = 0;
         MXFPP_CHECK(mxf_find_set_def(_cHeaderMetadata->dataModel, &cMetadataSet->key, &setDef));
@@ -224,7 +968,7 @@ MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
             iter = _objectFactory.find(setDef->key);
             if (iter != _objectFactory.end())
             {
-                set = (*iter).second->create(this, cMetadataSet);
+                set = (*iter).second->create(this, cMetadataSet, _arena);
                 break;
             }
             else
@@ -251,6 +995,7 @@ MetadataSet* HeaderMetadata::wrap(::MXFMetadataSet *cMetadataSet)
     ::MXFMetadataSet *cMetadataSet;
 
     MXFPP_CHECK(mxf_create_set(_cHeaderMetadata, key, &cMetadataSet));
+    markModified();
 
     return cMetadataSet;
 }
@@ -322,13 +1067,270 @@ void HeaderMetadata::initialiseObjectFactory()
 
 }
 
+bool HeaderMetadata::wrapReferencedSets(const uint8_t *uuidElements, uint32_t count, const mxfKey *itemKey,
+                                        vector<MetadataSet*> *sets)
+{
+    sets->clear();
+    sets->reserve(count);
+
+    // resolve references to sets that already have a C++ object using the object directory
+    vector<uint32_t> unresolved;
+    ObjectDirectory::const_iterator objIter;
+    mxfUUID instanceUID;
+    uint32_t i;
+    for (i = 0; i < count; i++)
+    {
+        mxf_get_uuid(&uuidElements[i * mxfUUID_extlen], &instanceUID);
+        objIter = _objectDirectory.find(instanceUID);
+        if (objIter != _objectDirectory.end() &&
+            (*objIter).second->getCMetadataSet()->headerMetadata == _cHeaderMetadata)
+        {
+            sets->push_back((*objIter).second);
+        }
+        else
+        {
+            sets->push_back(0);
+            unresolved.push_back(i);
+        }
+    }
+    if (unresolved.empty())
+        return true;
+
+    // resolve the remainder in a single pass through the header metadata sets
+    unordered_map<mxfUUID, ::MXFMetadataSet*> unresolvedCSets;
+    for (i = 0; i < unresolved.size(); i++)
+    {
+        mxf_get_uuid(&uuidElements[unresolved[i] * mxfUUID_extlen], &instanceUID);
+        unresolvedCSets[instanceUID] = 0;
+    }
+    unordered_map<mxfUUID, ::MXFMetadataSet*>::iterator cSetIter;
+    size_t numFound = 0;
+    ::MXFListIterator iter;
+    mxf_initialise_list_iter(&iter, &_cHeaderMetadata->sets);
+    while (numFound < unresolvedCSets.size() && mxf_next_list_iter_element(&iter))
+    {
+        ::MXFMetadataSet *cSet = (::MXFMetadataSet*)mxf_get_iter_element(&iter);
+        cSetIter = unresolvedCSets.find(cSet->instanceUID);
+        if (cSetIter != unresolvedCSets.end() && (*cSetIter).second == 0)
+        {
+            (*cSetIter).second = cSet;
+            numFound++;
+        }
+    }
+
+    bool complete = true;
+    for (i = 0; i < unresolved.size(); i++)
+    {
+        mxf_get_uuid(&uuidElements[unresolved[i] * mxfUUID_extlen], &instanceUID);
+        ::MXFMetadataSet *cSet = unresolvedCSets[instanceUID];
+        if (cSet)
+        {
+            (*sets)[unresolved[i]] = wrap(cSet);
+        }
+        else
+        {
+            char keyStr[KEY_STR_SIZE];
+            mxf_sprint_key(keyStr, itemKey);
+            mxf_log_warn("Failed to de-reference array element (item key = %s)\n", keyStr);
+            complete = false;
+        }
+    }
+    if (!complete)
+    {
+        sets->erase(std::remove(sets->begin(), sets->end(), (MetadataSet*)0), sets->end());
+    }
+
+    return complete;
+}
+
+void HeaderMetadata::encode(uint8_t llen, vector<unsigned char> *primerPackBytes, vector<unsigned char> *setBytes)
+{
+    MemoryEncoder encoder(llen);
+    MXFPP_CHECK(mxf_write_header_primer_pack(encoder.getCFile(), _cHeaderMetadata));
+    encoder.getData(primerPackBytes);
+
+    encoder.reset();
+    writeSets(encoder.getFile());
+    encoder.getData(setBytes);
+}
+
+void HeaderMetadata::writeCachedPrimerPack(File *file)
+{
+    uint8_t llen = file->getMinLLen();
+    size_t entryCount = mxf_get_list_length(&_cHeaderMetadata->primerPack->entries);
+
+    // the primer pack only changes when entries are registered
+    if (_primerPackBytes.empty() ||
+        _primerPackBytesPack != _cHeaderMetadata->primerPack ||
+        _primerPackBytesEntryCount != entryCount ||
+        _primerPackBytesLLen != llen)
+    {
+        MemoryEncoder encoder(llen);
+        MXFPP_CHECK(mxf_write_header_primer_pack(encoder.getCFile(), _cHeaderMetadata));
+        encoder.getData(&_primerPackBytes);
+
+        _primerPackBytesPack = _cHeaderMetadata->primerPack;
+        _primerPackBytesEntryCount = entryCount;
+        _primerPackBytesLLen = llen;
+    }
+
+    MXFPP_CHECK(file->write(&_primerPackBytes[0], (uint32_t)_primerPackBytes.size()) == _primerPackBytes.size());
+}
+
+void HeaderMetadata::writeSets(File *file)
+{
+    uint8_t llen = file->getMinLLen();
+    auto_ptr<MemoryEncoder> encoder;
+    vector<unsigned char> uncachedBytes;
+
+    map<MetadataSet*, vector<size_t> > setPatchItems;
+    size_t i;
+    for (i = 0; i < _patchItems.size(); i++)
+    {
+        _patchItems[i].fileOffset = -1;
+        setPatchItems[_patchItems[i].set].push_back(i);
+    }
+    map<MetadataSet*, vector<size_t> >::const_iterator patchIter;
+
+    // the Preface is written first, as is done by mxf_write_header_sets
+    ::MXFMetadataSet *prefaceSet;
+    if (!mxf_find_singular_set_by_key(_cHeaderMetadata, &MXF_SET_K(Preface), &prefaceSet))
+    {
+        throw MXFException("Header metadata is missing a Preface object");
+    }
+    vector< ::MXFMetadataSet*> cSets;
+    cSets.reserve(mxf_get_list_length(&_cHeaderMetadata->sets));
+    cSets.push_back(prefaceSet);
+    ::MXFListIterator iter;
+    mxf_initialise_list_iter(&iter, &_cHeaderMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        ::MXFMetadataSet *cSet = (::MXFMetadataSet*)mxf_get_iter_element(&iter);
+        if (cSet != prefaceSet)
+        {
+            cSets.push_back(cSet);
+        }
+    }
+
+    ObjectDirectory::const_iterator objIter;
+    for (i = 0; i < cSets.size(); i++)
+    {
+        ::MXFMetadataSet *cSet = cSets[i];
+
+        MetadataSet *set = 0;
+        objIter = _objectDirectory.find(cSet->instanceUID);
+        if (objIter != _objectDirectory.end() && (*objIter).second->_cMetadataSet == cSet)
+        {
+            set = (*objIter).second;
+        }
+
+        patchIter = setPatchItems.end();
+        if (set)
+        {
+            patchIter = setPatchItems.find(set);
+        }
+
+        if (!set || (!_writeCacheEnabled && patchIter == setPatchItems.end()))
+        {
+            MXFPP_CHECK(mxf_write_set(file->getCFile(), cSet));
+            continue;
+        }
+
+        vector<unsigned char> *encodedBytes = (_writeCacheEnabled ? &set->_encodedBytes : &uncachedBytes);
+        if (!_writeCacheEnabled ||
+            set->_encodedBytes.empty() ||
+            set->_encodedModificationCount != set->_modificationCount ||
+            set->_encodedLLen != llen)
+        {
+            if (!encoder.get())
+            {
+                encoder.reset(new MemoryEncoder(llen));
+            }
+            else
+            {
+                encoder->reset();
+            }
+            MXFPP_CHECK(mxf_write_set(encoder->getCFile(), cSet));
+            encoder->getData(encodedBytes);
+
+            if (_writeCacheEnabled)
+            {
+                set->_encodedModificationCount = set->_modificationCount;
+                set->_encodedLLen = llen;
+            }
+        }
+
+        if (patchIter != setPatchItems.end())
+        {
+            recordPatchItemOffsets(file->tell(), *encodedBytes, cSet, (*patchIter).second);
+        }
+
+        MXFPP_CHECK(file->write(&(*encodedBytes)[0], (uint32_t)encodedBytes->size()) == encodedBytes->size());
+    }
+}
+
+void HeaderMetadata::recordPatchItemOffsets(int64_t setFileOffset, const vector<unsigned char> &encodedBytes,
+                                            ::MXFMetadataSet *cSet, const vector<size_t> &patchItemIndexes)
+{
+    // the local tags of the items to patch
+    vector<mxfLocalTag> tags;
+    ::MXFMetadataItem *cItem;
+    size_t i;
+    for (i = 0; i < patchItemIndexes.size(); i++)
+    {
+        if (mxf_get_item(cSet, &_patchItems[patchItemIndexes[i]].itemKey, &cItem))
+            tags.push_back(cItem->tag);
+        else
+            tags.push_back(0);
+    }
+
+    // walk the local set items following the set key and length
+    uint64_t size = encodedBytes.size();
+    uint64_t offset = mxfKey_extlen;
+    uint8_t llen;
+    uint64_t len;
+    MXFPP_CHECK(size > offset && read_ber_length(&encodedBytes[(size_t)offset], size - offset, &llen, &len));
+    offset += llen;
+    while (offset + 4 <= size)
+    {
+        mxfLocalTag tag = (encodedBytes[(size_t)offset] << 8) | encodedBytes[(size_t)offset + 1];
+        uint16_t itemLen = (encodedBytes[(size_t)offset + 2] << 8) | encodedBytes[(size_t)offset + 3];
+        offset += 4;
+        if (offset + itemLen > size)
+            break;
+
+        for (i = 0; i < tags.size(); i++)
+        {
+            if (tags[i] != 0 && tags[i] == tag)
+            {
+                PatchItem &patchItem = _patchItems[patchItemIndexes[i]];
+                patchItem.fileOffset = setFileOffset + (int64_t)offset;
+                patchItem.writtenValue.assign(&encodedBytes[(size_t)offset], &encodedBytes[(size_t)offset] + itemLen);
+            }
+        }
+
+        offset += itemLen;
+    }
+}
+
 void HeaderMetadata::remove(MetadataSet *set)
 {
-    map<mxfUUID, MetadataSet*>::iterator objIter;
+    size_t i = 0;
+    while (i < _patchItems.size())
+    {
+        if (_patchItems[i].set == set)
+            _patchItems.erase(_patchItems.begin() + i);
+        else
+            i++;
+    }
+
+    ObjectDirectory::iterator objIter;
     objIter = _objectDirectory.find(set->getCMetadataSet()->instanceUID);
     if (objIter != _objectDirectory.end())
     {
         _objectDirectory.erase(objIter);
     }
+    _wrapperGeneration++;
+    _modificationCount++;
     // TODO: throw exception or log warning if set not in there?
 }
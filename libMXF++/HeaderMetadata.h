@@ -33,9 +33,11 @@
 #define MXFPP_HEADERMETADATA_H_
 
 #include <map>
+#include <unordered_map>
 
 #include <libMXF++/File.h>
 #include <libMXF++/DataModel.h>
+#include <libMXF++/MemoryArena.h>
 
 
 
@@ -45,12 +47,33 @@ namespace mxfpp
 
 class Preface;
 class HeaderMetadata;
+class PackageGraph;
 
 
 class HeaderMetadata
 {
 public:
     friend class MetadataSet; // allow metadata sets to remove themselves from the _objectDirectory
+    friend class HeaderMetadataTemplate;
+
+public:
+    // the libMXF structure and directory sizes are estimates that don't include the heap allocator overhead
+    typedef struct
+    {
+        size_t setCount;
+        std::map<mxfKey, size_t> setCountByKey;
+        size_t itemCount;
+        size_t itemValueBytes;
+        size_t cStructureBytes;     // libMXF set, item, list and primer pack structures
+        size_t wrapperCount;
+        size_t wrapperBytes;
+        size_t cacheBytes;          // write, reference array and primer pack caches
+        size_t directoryBytes;
+        size_t arenaAllocatedBytes;
+        size_t arenaReservedBytes;
+        size_t readEndBytes;        // the libMXF structures and transient read buffers still allocated when the
+                                    // last read completed. This is not a peak allocation measurement
+    } MemoryStats;
 
 public:
     static bool isHeaderMetadata(const mxfKey *key);
@@ -71,15 +94,54 @@ public:
 
     void registerPrimerEntry(const mxfUID *itemKey, mxfLocalTag newTag, mxfLocalTag *assignedTag);
 
+    // allocate the C++ wrappers and object directory from large blocks that are freed in the destructor
+    // must be called before any set is wrapped
+    void enableArenaAllocation(size_t blockSize = 64 * 1024);
+    MemoryArena* getArena() const { return _arena; }
+
 
     virtual void read(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len);
 	virtual void readFiltered(File *file, Partition *partition, MXFReadFilter *filter, const mxfKey *key, uint8_t llen, uint64_t len);
 
+    // reads the same header metadata as HeaderMetadata::read, but decodes the sets using numThreads threads
+    // numThreads 0 selects the number of hardware threads. Headers that are too large to hold in memory are
+    // read using read()
+    virtual void readParallel(File *file, Partition *partition, const mxfKey *key, uint8_t llen, uint64_t len,
+                      unsigned int numThreads = 0);
+
     virtual void write(File *file, Partition *partition, FillerWriter *filler);
 
+    // write() reuses the encoded primer pack and set bytes from the previous write if unchanged
+    // sets that don't have a C++ object are always re-encoded
+    void enableWriteCache(bool enable = true);
+
+    // write() records the file offset of registered items so that patchItems() can update their value in place
+    // the item value size must not change between write() and patchItems()
+    void registerPatchItem(MetadataSet *set, const mxfKey *itemKey);
+    void clearPatchItems();
+    void patchItems(File *file);
+
 
     Preface* getPreface();
 
+    // the modification count is incremented when a set is changed, created, read or deleted
+    uint32_t getModificationCount() const { return _modificationCount; }
+    void markModified();
+
+    // returns the package graph index, rebuilding it if the metadata has been modified
+    PackageGraph* getPackageGraph();
+
+    // wraps all sets and builds the reference, package graph and sequence indexes so that the getters can be
+    // called concurrently from multiple threads. Changes to a frozen header metadata result in an exception
+    void freeze();
+    bool isFrozen() const { return _frozen; }
+
+    void getMemoryStats(MemoryStats *stats) const;
+
+    // copies all sets to the (empty) toHeaderMetadata, optionally assigning new instance UIDs and remapping
+    // the strong and weak references to them
+    void cloneAll(HeaderMetadata *toHeaderMetadata, bool newInstanceUIDs = false) const;
+
 
     DataModel* getDataModel() const { return _dataModel; }
 
@@ -92,21 +154,61 @@ public:
 
     ::MXFHeaderMetadata* getCHeaderMetadata() const { return _cHeaderMetadata; }
 
+private:
+    typedef std::unordered_map<mxfUUID, MetadataSet*, std::hash<mxfUUID>, std::equal_to<mxfUUID>,
+                               ArenaAllocator<std::pair<const mxfUUID, MetadataSet*> > > ObjectDirectory;
+    typedef std::unordered_map<mxfKey, AbsMetadataSetFactory*> ObjectFactory;
+
+    typedef struct
+    {
+        MetadataSet *set;
+        mxfKey itemKey;
+        int64_t fileOffset;
+        std::vector<unsigned char> writtenValue;
+    } PatchItem;
+
+protected:
+    void updateReadEndBytes(size_t transientBytes);
+
 private:
     void initialiseObjectFactory();
     void remove(MetadataSet *set);
 
+    bool wrapReferencedSets(const uint8_t *uuidElements, uint32_t count, const mxfKey *itemKey,
+                            std::vector<MetadataSet*> *sets);
+
+    void encode(uint8_t llen, std::vector<unsigned char> *primerPackBytes, std::vector<unsigned char> *setBytes);
+    void writeCachedPrimerPack(File *file);
+    void writeSets(File *file);
+    void recordPatchItemOffsets(int64_t setFileOffset, const std::vector<unsigned char> &encodedBytes,
+                                ::MXFMetadataSet *cSet, const std::vector<size_t> &patchItemIndexes);
+
     DataModel *_dataModel;
 
-    std::map<mxfKey, AbsMetadataSetFactory*> _objectFactory;
+    ObjectFactory _objectFactory;
 
     ::MXFHeaderMetadata* _cHeaderMetadata;
     bool _ownCHeaderMetadata;
-    std::map<mxfUUID, MetadataSet*> _objectDirectory;
+    MemoryArena *_arena;
+    ObjectDirectory _objectDirectory;
+    uint32_t _wrapperGeneration;
+    uint32_t _modificationCount;
+    bool _frozen;
+    size_t _readEndBytes;
+    PackageGraph *_packageGraph;
+    uint32_t _packageGraphModificationCount;
     bool _busyDestructing;
 
     bool _initGenerationUID;
     mxfUUID _generationUID;
+
+    bool _writeCacheEnabled;
+    std::vector<unsigned char> _primerPackBytes;
+    ::MXFPrimerPack *_primerPackBytesPack;
+    size_t _primerPackBytesEntryCount;
+    uint8_t _primerPackBytesLLen;
+
+    std::vector<PatchItem> _patchItems;
 };
 
 
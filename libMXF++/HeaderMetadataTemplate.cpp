@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstring>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+
+HeaderMetadataTemplate::HeaderMetadataTemplate(HeaderMetadata *headerMetadata)
+{
+    _headerMetadata = headerMetadata;
+    _compiled = false;
+    _llen = 0;
+}
+
+HeaderMetadataTemplate::~HeaderMetadataTemplate()
+{
+}
+
+size_t HeaderMetadataTemplate::registerPatchItem(MetadataSet *set, const mxfKey *itemKey)
+{
+    MXFPP_CHECK(set->getHeaderMetadata() == _headerMetadata);
+    MXFPP_CHECK(set->haveItem(itemKey));
+
+    TemplateItem item;
+    item.set = set;
+    item.itemKey = *itemKey;
+    item.offset = 0;
+    item.size = 0;
+    _items.push_back(item);
+    _compiled = false;
+
+    return _items.size() - 1;
+}
+
+void HeaderMetadataTemplate::compile(uint8_t llen)
+{
+    // use the header metadata's patch items to locate the template items in the encoded sets
+    vector<HeaderMetadata::PatchItem> headerPatchItems;
+    headerPatchItems.swap(_headerMetadata->_patchItems);
+    try
+    {
+        size_t i;
+        for (i = 0; i < _items.size(); i++)
+            _headerMetadata->registerPatchItem(_items[i].set, &_items[i].itemKey);
+
+        _headerMetadata->encode(llen, &_primerPackBytes, &_setBytes);
+
+        for (i = 0; i < _items.size(); i++)
+        {
+            const HeaderMetadata::PatchItem &patchItem = _headerMetadata->_patchItems[i];
+            if (patchItem.fileOffset < 0)
+                throw MXFException("Header metadata template item was not found in the encoded sets");
+
+            _items[i].offset = (size_t)patchItem.fileOffset;
+            _items[i].size = (uint16_t)patchItem.writtenValue.size();
+        }
+    }
+    catch (...)
+    {
+        _headerMetadata->_patchItems.swap(headerPatchItems);
+        throw;
+    }
+    _headerMetadata->_patchItems.swap(headerPatchItems);
+
+    _llen = llen;
+    _compiled = true;
+}
+
+void HeaderMetadataTemplate::setItemValue(size_t index, const unsigned char *value, uint16_t size)
+{
+    memcpy(getItemBytes(index, size), value, size);
+}
+
+void HeaderMetadataTemplate::setUInt32Item(size_t index, uint32_t value)
+{
+    mxf_set_uint32(value, getItemBytes(index, 4));
+}
+
+void HeaderMetadataTemplate::setInt64Item(size_t index, int64_t value)
+{
+    mxf_set_int64(value, getItemBytes(index, 8));
+}
+
+void HeaderMetadataTemplate::setRationalItem(size_t index, mxfRational value)
+{
+    mxf_set_rational(&value, getItemBytes(index, mxfRational_extlen));
+}
+
+void HeaderMetadataTemplate::setTimestampItem(size_t index, mxfTimestamp value)
+{
+    mxf_set_timestamp(&value, getItemBytes(index, mxfTimestamp_extlen));
+}
+
+void HeaderMetadataTemplate::setUUIDItem(size_t index, mxfUUID value)
+{
+    mxf_set_uuid(&value, getItemBytes(index, mxfUUID_extlen));
+}
+
+void HeaderMetadataTemplate::setUMIDItem(size_t index, mxfUMID value)
+{
+    mxf_set_umid(&value, getItemBytes(index, mxfUMID_extlen));
+}
+
+void HeaderMetadataTemplate::write(File *file, Partition *partition, FillerWriter *filler)
+{
+    MXFPP_CHECK(_compiled);
+    if (file->getMinLLen() != _llen)
+    {
+        throw MXFException("Header metadata template was compiled with llen %u but the file llen is %u",
+                           _llen, file->getMinLLen());
+    }
+
+    partition->markHeaderStart(file);
+
+    MXFPP_CHECK(file->write(&_primerPackBytes[0], (uint32_t)_primerPackBytes.size()) == _primerPackBytes.size());
+    partition->fillToKag(file);
+    if (!_setBytes.empty())
+        MXFPP_CHECK(file->write(&_setBytes[0], (uint32_t)_setBytes.size()) == _setBytes.size());
+    if (filler)
+    {
+        filler->write(file);
+    }
+    else
+    {
+        partition->fillToKag(file);
+    }
+
+    partition->markHeaderEnd(file);
+}
+
+unsigned char* HeaderMetadataTemplate::getItemBytes(size_t index, uint16_t size)
+{
+    MXFPP_CHECK(_compiled);
+    MXFPP_CHECK(index < _items.size());
+    if (_items[index].size != size)
+    {
+        throw MXFException("Header metadata template item value size %u does not equal the compiled size %u",
+                           size, _items[index].size);
+    }
+
+    return &_setBytes[_items[index].offset];
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_HEADER_METADATA_TEMPLATE_H_
+#define MXFPP_HEADER_METADATA_TEMPLATE_H_
+
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+// The encoded primer pack and sets of a header metadata, with the location of the items that are changed per file.
+// A file's header metadata is written by copying the encoded bytes after updating the items
+
+class HeaderMetadataTemplate
+{
+public:
+    HeaderMetadataTemplate(HeaderMetadata *headerMetadata);
+    ~HeaderMetadataTemplate();
+
+    // returns the index used to set the item value. The set must exist until compile() is called
+    size_t registerPatchItem(MetadataSet *set, const mxfKey *itemKey);
+
+    void compile(uint8_t llen);
+    bool isCompiled() const { return _compiled; }
+
+    // the value size must equal the size of the compiled item value
+    void setItemValue(size_t index, const unsigned char *value, uint16_t size);
+    void setUInt32Item(size_t index, uint32_t value);
+    void setInt64Item(size_t index, int64_t value);
+    void setRationalItem(size_t index, mxfRational value);
+    void setTimestampItem(size_t index, mxfTimestamp value);
+    void setUUIDItem(size_t index, mxfUUID value);
+    void setUMIDItem(size_t index, mxfUMID value);
+
+    // writes the header metadata in the same way as HeaderMetadata::write
+    // the file's minimum llen must equal the llen passed to compile()
+    void write(File *file, Partition *partition, FillerWriter *filler);
+
+    const std::vector<unsigned char>& getPrimerPackBytes() const { return _primerPackBytes; }
+    const std::vector<unsigned char>& getSetBytes() const { return _setBytes; }
+
+private:
+    typedef struct
+    {
+        MetadataSet *set;
+        mxfKey itemKey;
+        size_t offset;
+        uint16_t size;
+    } TemplateItem;
+
+private:
+    unsigned char* getItemBytes(size_t index, uint16_t size);
+
+    HeaderMetadata *_headerMetadata;
+    std::vector<TemplateItem> _items;
+    bool _compiled;
+    uint8_t _llen;
+    std::vector<unsigned char> _primerPackBytes;
+    std::vector<unsigned char> _setBytes;
+};
+
+
+};
+
+
+
+#endif
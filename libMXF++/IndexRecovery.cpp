@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include <libMXF++/MXF.h>
+
+#include <mxf/mxf_avid.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define DEFAULT_CHUNK_SIZE          (64 * 1024 * 1024)
+#define RESYNC_BUFFER_SIZE          (64 * 1024)
+// number of following KLVs that must be valid for a key found in a chunk to be accepted
+#define RESYNC_VALIDATE_COUNT       2
+#define MIN_FILL_SIZE               (mxfKey_extlen + 9)
+
+
+
+static bool is_key_prefix(const uint8_t *bytes)
+{
+    return bytes[0] == 0x06 && bytes[1] == 0x0e && bytes[2] == 0x2b && bytes[3] == 0x34;
+}
+
+static bool is_system_item(const mxfKey *key)
+{
+    // GC system item (0x14) or SDTI-CP compatible system item (0x04)
+    const uint8_t *bytes = (const uint8_t*)key;
+    return is_key_prefix(bytes) &&
+           bytes[6] == 0x01 && bytes[7] == 0x01 && bytes[8] == 0x0d && bytes[9] == 0x01 &&
+           bytes[10] == 0x03 && bytes[11] == 0x01 &&
+           (bytes[12] == 0x04 || bytes[12] == 0x14);
+}
+
+static int64_t get_klv_end(const IndexRecovery::KLVInfo &klv)
+{
+    return klv.filePosition + mxfKey_extlen + klv.llen + (int64_t)klv.len;
+}
+
+static bool read_kl_at(MXFFile *cFile, int64_t fileSize, int64_t position, IndexRecovery::KLVInfo *klv)
+{
+    if (position + mxfKey_extlen + 1 > fileSize ||
+        !mxf_file_seek(cFile, position, SEEK_SET) ||
+        !mxf_read_kl(cFile, &klv->key, &klv->llen, &klv->len) ||
+        !is_key_prefix((const uint8_t*)&klv->key) ||
+        klv->len > (uint64_t)fileSize)
+    {
+        return false;
+    }
+
+    klv->filePosition = position;
+    return true;
+}
+
+// walks complete KLVs starting at position until a KLV starts at or beyond end. Returns the position where
+// walking stopped, which is before end if an invalid or truncated KLV was found
+static int64_t walk_klvs(MXFFile *cFile, int64_t fileSize, int64_t position, int64_t end,
+                         vector<IndexRecovery::KLVInfo> *klvs)
+{
+    IndexRecovery::KLVInfo klv;
+    while (position < end) {
+        if (!read_kl_at(cFile, fileSize, position, &klv) || get_klv_end(klv) > fileSize)
+            break;
+        klvs->push_back(klv);
+        position = get_klv_end(klv);
+    }
+
+    return position;
+}
+
+static bool validate_key(MXFFile *cFile, int64_t fileSize, int64_t position)
+{
+    IndexRecovery::KLVInfo klv;
+    int i;
+    for (i = 0; i <= RESYNC_VALIDATE_COUNT; i++) {
+        if (!read_kl_at(cFile, fileSize, position, &klv) || get_klv_end(klv) > fileSize)
+            return false;
+        position = get_klv_end(klv);
+        if (position == fileSize)
+            break;
+    }
+
+    return true;
+}
+
+// returns the position of the first valid key in [start, end) or -1 if none was found
+static int64_t resync(MXFFile *cFile, int64_t fileSize, int64_t start, int64_t end)
+{
+    vector<uint8_t> buffer(RESYNC_BUFFER_SIZE);
+    int64_t position = start;
+    while (position < end) {
+        uint32_t count = RESYNC_BUFFER_SIZE;
+        if (fileSize - position < count)
+            count = (uint32_t)(fileSize - position);
+        if (count < 4 ||
+            !mxf_file_seek(cFile, position, SEEK_SET) ||
+            mxf_file_read(cFile, &buffer[0], count) != count)
+        {
+            break;
+        }
+
+        uint32_t i;
+        for (i = 0; i + 4 <= count; i++) {
+            if (position + i >= end)
+                return -1;
+            if (is_key_prefix(&buffer[i]) && validate_key(cFile, fileSize, position + i))
+                return position + i;
+        }
+
+        // overlap to find a prefix that crosses the buffer boundary
+        position += count - 3;
+    }
+
+    return -1;
+}
+
+
+
+// Utility class to scan a chunk of the file in a separate thread
+class ChunkScanner
+{
+public:
+    ChunkScanner()
+    {
+        _fileSize = 0;
+        _start = 0;
+        _end = 0;
+        _isFirst = false;
+        _stopPosition = 0;
+        _failed = false;
+    }
+
+    void init(const string &filename, int64_t fileSize, int64_t start, int64_t end, bool isFirst)
+    {
+        _filename = filename;
+        _fileSize = fileSize;
+        _start = start;
+        _end = end;
+        _isFirst = isFirst;
+        _stopPosition = end;
+    }
+
+    void scan()
+    {
+        try
+        {
+            auto_ptr<File> file(File::openRead(_filename));
+
+            int64_t position = _start;
+            if (!_isFirst)
+                position = resync(file->getCFile(), _fileSize, _start, _end);
+            if (position >= 0)
+                _stopPosition = walk_klvs(file->getCFile(), _fileSize, position, _end, &_klvs);
+        }
+        catch (...)
+        {
+            _failed = true;
+        }
+    }
+
+    int64_t getEnd() const { return _end; }
+    int64_t getStopPosition() const { return _stopPosition; }
+    const vector<IndexRecovery::KLVInfo>& getKLVs() const { return _klvs; }
+    bool failed() const { return _failed; }
+
+private:
+    string _filename;
+    int64_t _fileSize;
+    int64_t _start;
+    int64_t _end;
+    bool _isFirst;
+    int64_t _stopPosition;
+    vector<IndexRecovery::KLVInfo> _klvs;
+    bool _failed;
+};
+
+
+static void scan_chunks(vector<ChunkScanner> *scanners, size_t first, size_t step)
+{
+    size_t i;
+    for (i = first; i < scanners->size(); i += step)
+        (*scanners)[i].scan();
+}
+
+static bool klv_position_less(const IndexRecovery::KLVInfo &left, int64_t position)
+{
+    return left.filePosition < position;
+}
+
+
+
+IndexRecovery::IndexRecovery(const string &filename)
+{
+    _filename = filename;
+    _numThreads = 0;
+    _chunkSize = DEFAULT_CHUNK_SIZE;
+    _fileSize = 0;
+    _recoveredEnd = 0;
+    _haveTruncatedKey = false;
+    _essenceStreamSize = 0;
+}
+
+IndexRecovery::~IndexRecovery()
+{
+}
+
+void IndexRecovery::setNumThreads(unsigned int numThreads)
+{
+    _numThreads = numThreads;
+}
+
+void IndexRecovery::setChunkSize(uint64_t chunkSize)
+{
+    MXFPP_CHECK(chunkSize > 0);
+    _chunkSize = chunkSize;
+}
+
+void IndexRecovery::scan()
+{
+    auto_ptr<File> file(File::openRead(_filename));
+    _fileSize = file->size();
+    int64_t start = mxf_get_runin_len(file->getCFile());
+
+    _klvs.clear();
+    _recoveredEnd = start;
+
+
+    // scan the chunks in parallel
+
+    size_t numChunks = (size_t)((_fileSize - start + _chunkSize - 1) / _chunkSize);
+    if (numChunks == 0)
+        numChunks = 1;
+    vector<ChunkScanner> scanners(numChunks);
+    size_t i;
+    for (i = 0; i < numChunks; i++) {
+        int64_t chunk_start = start + (int64_t)(i * _chunkSize);
+        int64_t chunk_end = (i + 1 == numChunks ? _fileSize : chunk_start + (int64_t)_chunkSize);
+        scanners[i].init(_filename, _fileSize, chunk_start, chunk_end, i == 0);
+    }
+
+    unsigned int numThreads = _numThreads;
+    if (numThreads == 0)
+        numThreads = thread::hardware_concurrency();
+    if (numThreads == 0)
+        numThreads = 1;
+    if (numThreads > numChunks)
+        numThreads = (unsigned int)numChunks;
+
+    vector<thread> threads;
+    for (i = 1; i < numThreads; i++)
+        threads.push_back(thread(scan_chunks, &scanners, i, (size_t)numThreads));
+    scan_chunks(&scanners, 0, numThreads);
+    for (i = 0; i < threads.size(); i++)
+        threads[i].join();
+
+
+    // merge the chunk results, re-scanning a chunk if it did not resynchronise on the expected KLV
+
+    int64_t expected = start;
+    for (i = 0; i < numChunks; i++) {
+        const ChunkScanner &scanner = scanners[i];
+        if (scanner.failed())
+            throw MXFException("Failed to scan chunk %" PRIszt " for index recovery", i);
+        if (expected >= scanner.getEnd())
+            continue;
+
+        const vector<KLVInfo> &chunk_klvs = scanner.getKLVs();
+        vector<KLVInfo>::const_iterator iter = lower_bound(chunk_klvs.begin(), chunk_klvs.end(), expected,
+                                                           klv_position_less);
+        if (iter != chunk_klvs.end() && iter->filePosition == expected) {
+            _klvs.insert(_klvs.end(), iter, chunk_klvs.end());
+            expected = scanner.getStopPosition();
+        } else {
+            expected = walk_klvs(file->getCFile(), _fileSize, expected, scanner.getEnd(), &_klvs);
+        }
+
+        if (expected < scanner.getEnd())
+            break;
+    }
+    _recoveredEnd = (expected < _fileSize ? expected : _fileSize);
+
+    KLVInfo truncated_klv;
+    _haveTruncatedKey = (_recoveredEnd < _fileSize &&
+                         read_kl_at(file->getCFile(), _fileSize, _recoveredEnd, &truncated_klv));
+    if (_haveTruncatedKey)
+        _truncatedKey = truncated_klv.key;
+
+    updateEditUnits();
+}
+
+IndexTableSegment* IndexRecovery::createIndexTableSegment(uint32_t indexSID, uint32_t bodySID,
+                                                          mxfRational editRate) const
+{
+    auto_ptr<IndexTableSegment> segment(new IndexTableSegment());
+    mxfUUID uuid;
+    mxf_generate_uuid(&uuid);
+    segment->setInstanceUID(uuid);
+    segment->setIndexEditRate(editRate);
+    segment->setIndexStartPosition(0);
+    segment->setIndexDuration((int64_t)_editUnitOffsets.size());
+    segment->setIndexSID(indexSID);
+    segment->setBodySID(bodySID);
+    segment->setEditUnitByteCount(0);
+
+    uint32_t count = (uint32_t)_editUnitOffsets.size();
+    if (count > 0) {
+        vector<int8_t> offsets(count, 0);
+        vector<uint8_t> flags(count, 0);
+        segment->appendIndexEntries(count, &offsets[0], &offsets[0], &flags[0], &_editUnitOffsets[0], 0, 0);
+    }
+
+    return segment.release();
+}
+
+void IndexRecovery::writeIndex(File *mxfFile, IndexTableSegment *segment) const
+{
+    MXFPP_CHECK(mxfFile->readHeaderPartition());
+
+    // read the body partitions and replace any existing footer partition
+    int64_t footer_position = _recoveredEnd;
+    bool have_header = false;
+    size_t i;
+    for (i = 0; i < _klvs.size(); i++) {
+        if (!mxf_is_partition_pack(&_klvs[i].key))
+            continue;
+        if (!have_header) {
+            have_header = true;
+            continue;
+        }
+        if (mxf_is_footer_partition_pack(&_klvs[i].key)) {
+            footer_position = _klvs[i].filePosition;
+            break;
+        }
+
+        mxfKey key;
+        uint8_t llen;
+        uint64_t len;
+        mxfFile->seek(_klvs[i].filePosition, SEEK_SET);
+        mxfFile->readKL(&key, &llen, &len);
+        mxfFile->readNextPartition(&key, len);
+    }
+
+    mxfFile->seek(footer_position, SEEK_SET);
+    Partition &footer_partition = mxfFile->createPartition();
+    footer_partition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+    footer_partition.setIndexSID(segment->getIndexSID());
+    footer_partition.setBodySID(0);
+    footer_partition.write(mxfFile);
+
+    segment->write(mxfFile, &footer_partition, 0);
+
+    // fill over the remaining bytes of the original file so that the RIP is at the end of the file
+    uint64_t rip_len = 4 + 12 * (uint64_t)mxfFile->getPartitions().size();
+    int64_t rip_start = _fileSize - (mxfKey_extlen + mxf_get_llen(mxfFile->getCFile(), rip_len) + (int64_t)rip_len);
+    if (rip_start > mxfFile->tell()) {
+        if (rip_start < mxfFile->tell() + MIN_FILL_SIZE)
+            rip_start = mxfFile->tell() + MIN_FILL_SIZE;
+        mxfFile->fillToPosition(rip_start);
+    }
+
+    mxfFile->writeRIP();
+    mxfFile->updatePartitions();
+}
+
+void IndexRecovery::updateEditUnits()
+{
+    _editUnitOffsets.clear();
+    _essenceStreamSize = 0;
+
+    mxfKey edit_unit_key;
+    bool have_edit_unit_key = false;
+    bool in_essence = false;
+    size_t i;
+    for (i = 0; i < _klvs.size(); i++) {
+        const KLVInfo &klv = _klvs[i];
+        if (mxf_is_partition_pack(&klv.key)) {
+            in_essence = false;
+            continue;
+        }
+
+        if (mxf_is_gc_essence_element(&klv.key) || mxf_avid_is_essence_element(&klv.key) ||
+            is_system_item(&klv.key))
+        {
+            in_essence = true;
+            if (!have_edit_unit_key) {
+                edit_unit_key = klv.key;
+                have_edit_unit_key = true;
+            }
+            if (klv.key == edit_unit_key)
+                _editUnitOffsets.push_back(_essenceStreamSize);
+        }
+        else if (!in_essence || !mxf_is_filler(&klv.key))
+        {
+            in_essence = false;
+            continue;
+        }
+
+        _essenceStreamSize += mxfKey_extlen + klv.llen + klv.len;
+    }
+
+    // the last edit unit in a truncated file may be incomplete
+    if (isTruncated() && !_editUnitOffsets.empty() &&
+        !(have_edit_unit_key && _haveTruncatedKey && _truncatedKey == edit_unit_key))
+    {
+        _essenceStreamSize = _editUnitOffsets.back();
+        _editUnitOffsets.pop_back();
+    }
+}
+
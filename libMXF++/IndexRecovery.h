@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_INDEX_RECOVERY_H_
+#define MXFPP_INDEX_RECOVERY_H_
+
+#include <string>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+// reconstructs the index of frame wrapped essence by scanning the KLVs in the file. The file is split into
+// chunks that are scanned in parallel, with each chunk (except the first) resynchronising on the next valid
+// KLV key. The chunk results are merged sequentially, re-scanning a chunk if its resynchronisation point is
+// not on the KLV boundary reached by the preceding chunk
+class IndexRecovery
+{
+public:
+    typedef struct
+    {
+        int64_t filePosition;
+        mxfKey key;
+        uint8_t llen;
+        uint64_t len;
+    } KLVInfo;
+
+public:
+    IndexRecovery(const std::string &filename);
+    ~IndexRecovery();
+
+    // numThreads 0 selects the number of hardware threads
+    void setNumThreads(unsigned int numThreads);
+    void setChunkSize(uint64_t chunkSize);
+
+    void scan();
+
+    const std::vector<KLVInfo>& getKLVs() const { return _klvs; }
+    int64_t getFileSize() const { return _fileSize; }
+    int64_t getRecoveredEnd() const { return _recoveredEnd; }
+    bool isTruncated() const { return _recoveredEnd < _fileSize; }
+
+    // the stream offsets of the edit units. An edit unit starts at each essence element or system item
+    // with the same key as the first one in the essence container. The last edit unit in a truncated file
+    // is excluded unless the truncated KLV starts a new edit unit
+    const std::vector<uint64_t>& getEditUnitOffsets() const { return _editUnitOffsets; }
+    uint64_t getEssenceStreamSize() const { return _essenceStreamSize; }
+
+    // the index entries have zero flags and offsets because picture types are not recovered
+    IndexTableSegment* createIndexTableSegment(uint32_t indexSID, uint32_t bodySID, mxfRational editRate) const;
+
+    // replaces any existing footer partition, or the truncated end of the file, with a footer partition
+    // containing the segment, followed by a RIP. The file must be opened with File::openModify
+    void writeIndex(File *mxfFile, IndexTableSegment *segment) const;
+
+private:
+    void updateEditUnits();
+
+private:
+    std::string _filename;
+    unsigned int _numThreads;
+    uint64_t _chunkSize;
+
+    int64_t _fileSize;
+    int64_t _recoveredEnd;
+    bool _haveTruncatedKey;
+    mxfKey _truncatedKey;
+    std::vector<KLVInfo> _klvs;
+    std::vector<uint64_t> _editUnitOffsets;
+    uint64_t _essenceStreamSize;
+};
+
+
+};
+
+
+
+#endif
+
@@ -33,6 +33,8 @@
 #include "config.h"
 #endif
 
+#include <algorithm>
+
 #include <libMXF++/MXF.h>
 
 #include <mxf/mxf_avid.h>
@@ -41,6 +43,37 @@ using namespace std;
 using namespace mxfpp;
 
 
+#define DELTA_ENTRY_SIZE            6
+#define INDEX_ENTRY_BASE_SIZE       11
+#define INDEX_WRITE_BUFFER_SIZE     (256 * 1024)
+
+
+
+static void serialize_index_entry(uint8_t *bytes, int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags,
+                                  uint64_t streamOffset, const uint32_t *sliceOffset, uint8_t sliceCount,
+                                  const mxfRational *posTable, uint8_t posTableCount)
+{
+    bytes[0] = (uint8_t)temporalOffset;
+    bytes[1] = (uint8_t)keyFrameOffset;
+    bytes[2] = flags;
+    store_be_uint64(&bytes[3], streamOffset);
+    bytes += INDEX_ENTRY_BASE_SIZE;
+
+    uint8_t i;
+    for (i = 0; i < sliceCount; i++)
+    {
+        store_be_uint32(bytes, sliceOffset[i]);
+        bytes += 4;
+    }
+    for (i = 0; i < posTableCount; i++)
+    {
+        store_be_uint32(bytes,     (uint32_t)posTable[i].numerator);
+        store_be_uint32(bytes + 4, (uint32_t)posTable[i].denominator);
+        bytes += 8;
+    }
+}
+
+
 
 bool IndexTableSegment::isIndexTableSegment(const mxfKey *key)
 {
@@ -56,14 +89,18 @@ IndexTableSegment* IndexTableSegment::read(File *mxfFile, uint64_t segmentLen)
 
 
 IndexTableSegment::IndexTableSegment()
-: _cSegment(0)
+: _cSegment(0), _lastDeltaEntry(0)
 {
     MXFPP_CHECK(mxf_create_index_table_segment(&_cSegment));
 }
 
 IndexTableSegment::IndexTableSegment(::MXFIndexTableSegment *cSegment)
-: _cSegment(cSegment)
-{}
+: _cSegment(cSegment), _lastDeltaEntry(0)
+{
+    const ::MXFDeltaEntry *cEntry;
+    for (cEntry = _cSegment->deltaEntryArray; cEntry; cEntry = cEntry->next)
+        addDeltaEntryToArray(cEntry);
+}
 
 IndexTableSegment::~IndexTableSegment()
 {
@@ -143,28 +180,13 @@ mxfOptBool IndexTableSegment::getForwardIndexDirection() const
 
 bool IndexTableSegment::haveDeltaEntryAtDelta(uint32_t delta, uint8_t slice) const
 {
-    MXFDeltaEntry *entry = _cSegment->deltaEntryArray;
-    while (entry &&
-            (entry->slice < slice ||
-                (entry->slice == slice && entry->elementData < delta)))
-    {
-        entry = entry->next;
-    }
-
-    return (entry && entry->slice == slice && entry->elementData == delta);
+    return findDeltaEntry(delta, slice) != 0;
 }
 
 const MXFDeltaEntry* IndexTableSegment::getDeltaEntryAtDelta(uint32_t delta, uint8_t slice) const
 {
-    MXFDeltaEntry *entry = _cSegment->deltaEntryArray;
-    while (entry &&
-            (entry->slice < slice ||
-                (entry->slice == slice && entry->elementData < delta)))
-    {
-        entry = entry->next;
-    }
-
-    MXFPP_ASSERT(entry && entry->slice == slice && entry->elementData == delta);
+    const MXFDeltaEntry *entry = findDeltaEntry(delta, slice);
+    MXFPP_ASSERT(entry);
     return entry;
 }
 
@@ -252,12 +274,25 @@ void IndexTableSegment::setForwardIndexDirection(mxfOptBool value)
 void IndexTableSegment::appendDeltaEntry(int8_t posTableIndex, uint8_t slice, uint32_t elementData)
 {
     MXFPP_CHECK(mxf_default_add_delta_entry(NULL, 0, _cSegment, posTableIndex, slice, elementData));
+
+    // libMXF appends the entry to the end of the list
+    const ::MXFDeltaEntry *cEntry = (_lastDeltaEntry ? _lastDeltaEntry->next : _cSegment->deltaEntryArray);
+    MXFPP_CHECK(cEntry && !cEntry->next);
+    addDeltaEntryToArray(cEntry);
 }
 
 void IndexTableSegment::appendIndexEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags,
                                          uint64_t streamOffset, const vector<uint32_t> &sliceOffset,
                                          const vector<mxfRational> &posTable)
 {
+    if (!_bulkStreamOffsets.empty())
+    {
+        MXFPP_CHECK(sliceOffset.size() == _cSegment->sliceCount && posTable.size() == _cSegment->posTableCount);
+        appendIndexEntries(1, &temporalOffset, &keyFrameOffset, &flags, &streamOffset,
+                           (sliceOffset.empty() ? 0 : &sliceOffset[0]), (posTable.empty() ? 0 : &posTable[0]));
+        return;
+    }
+
     uint32_t *cSliceOffset = 0;
     mxfRational *cPosTable = 0;
     uint8_t i;
@@ -296,11 +331,61 @@ void IndexTableSegment::appendIndexEntry(int8_t temporalOffset, int8_t keyFrameO
     }
 }
 
+void IndexTableSegment::appendIndexEntries(uint32_t count, const int8_t *temporalOffsets,
+                                           const int8_t *keyFrameOffsets, const uint8_t *flags,
+                                           const uint64_t *streamOffsets, const uint32_t *sliceOffsets,
+                                           const mxfRational *posTables)
+{
+    if (count == 0)
+        return;
+    MXFPP_CHECK(_cSegment->sliceCount == 0 || sliceOffsets);
+    MXFPP_CHECK(_cSegment->posTableCount == 0 || posTables);
+
+    _bulkTemporalOffsets.insert(_bulkTemporalOffsets.end(), temporalOffsets, temporalOffsets + count);
+    _bulkKeyFrameOffsets.insert(_bulkKeyFrameOffsets.end(), keyFrameOffsets, keyFrameOffsets + count);
+    _bulkFlags.insert(_bulkFlags.end(), flags, flags + count);
+    _bulkStreamOffsets.insert(_bulkStreamOffsets.end(), streamOffsets, streamOffsets + count);
+    if (_cSegment->sliceCount > 0)
+        _bulkSliceOffsets.insert(_bulkSliceOffsets.end(), sliceOffsets, sliceOffsets + count * _cSegment->sliceCount);
+    if (_cSegment->posTableCount > 0)
+        _bulkPosTables.insert(_bulkPosTables.end(), posTables, posTables + count * _cSegment->posTableCount);
+}
+
+void IndexTableSegment::reserveIndexEntries(uint32_t count)
+{
+    _bulkTemporalOffsets.reserve(count);
+    _bulkKeyFrameOffsets.reserve(count);
+    _bulkFlags.reserve(count);
+    _bulkStreamOffsets.reserve(count);
+    _bulkSliceOffsets.reserve(count * _cSegment->sliceCount);
+    _bulkPosTables.reserve(count * _cSegment->posTableCount);
+}
+
+void IndexTableSegment::clearIndexEntries()
+{
+    if (_cSegment->indexEntryArray)
+    {
+        // use libMXF to free the entry list
+        ::MXFIndexTableSegment *cSegment;
+        MXFPP_CHECK(mxf_create_index_table_segment(&cSegment));
+        cSegment->indexEntryArray = _cSegment->indexEntryArray;
+        _cSegment->indexEntryArray = 0;
+        mxf_free_index_table_segment(&cSegment);
+    }
+
+    _bulkTemporalOffsets.clear();
+    _bulkKeyFrameOffsets.clear();
+    _bulkFlags.clear();
+    _bulkStreamOffsets.clear();
+    _bulkSliceOffsets.clear();
+    _bulkPosTables.clear();
+}
+
 void IndexTableSegment::write(File *mxfFile, Partition *partition, FillerWriter *filler)
 {
     partition->markIndexStart(mxfFile);
 
-    MXFPP_CHECK(mxf_write_index_table_segment(mxfFile->getCFile(), _cSegment));
+    writeSegment(mxfFile);
     if (filler)
     {
         filler->write(mxfFile);
@@ -313,6 +398,169 @@ void IndexTableSegment::write(File *mxfFile, Partition *partition, FillerWriter
     partition->markIndexEnd(mxfFile);
 }
 
+void IndexTableSegment::addDeltaEntryToArray(const MXFDeltaEntry *cEntry)
+{
+    _deltaEntries.push_back(*cEntry);
+    _deltaEntries.back().next = 0;
+    _lastDeltaEntry = cEntry;
+
+    // the first entry is used if there are duplicates
+    _deltaEntryIndex.insert(make_pair(((uint64_t)cEntry->slice << 32) | cEntry->elementData, cEntry));
+}
+
+const MXFDeltaEntry* IndexTableSegment::findDeltaEntry(uint32_t delta, uint8_t slice) const
+{
+    unordered_map<uint64_t, const MXFDeltaEntry*>::const_iterator iter =
+        _deltaEntryIndex.find(((uint64_t)slice << 32) | delta);
+    if (iter == _deltaEntryIndex.end())
+        return 0;
+
+    return iter->second;
+}
+
+uint32_t IndexTableSegment::getNumIndexEntries() const
+{
+    uint32_t numIndexEntries = 0;
+    const ::MXFIndexEntry *cEntry;
+    for (cEntry = _cSegment->indexEntryArray; cEntry; cEntry = cEntry->next)
+        numIndexEntries++;
+
+    return numIndexEntries + (uint32_t)_bulkStreamOffsets.size();
+}
+
+bool IndexTableSegment::getIndexEntry(uint32_t index, int8_t *temporalOffset, int8_t *keyFrameOffset,
+                                      uint8_t *flags, uint64_t *streamOffset, vector<uint32_t> *sliceOffset,
+                                      vector<mxfRational> *posTable) const
+{
+    uint8_t sliceCount = _cSegment->sliceCount;
+    uint8_t posTableCount = _cSegment->posTableCount;
+
+    const ::MXFIndexEntry *cEntry = _cSegment->indexEntryArray;
+    while (cEntry && index > 0)
+    {
+        cEntry = cEntry->next;
+        index--;
+    }
+    if (cEntry)
+    {
+        *temporalOffset = cEntry->temporalOffset;
+        *keyFrameOffset = cEntry->keyFrameOffset;
+        *flags = cEntry->flags;
+        *streamOffset = cEntry->streamOffset;
+        if (sliceOffset)
+        {
+            sliceOffset->clear();
+            if (cEntry->sliceOffset)
+                sliceOffset->assign(cEntry->sliceOffset, cEntry->sliceOffset + sliceCount);
+        }
+        if (posTable)
+        {
+            posTable->clear();
+            if (cEntry->posTable)
+                posTable->assign(cEntry->posTable, cEntry->posTable + posTableCount);
+        }
+        return true;
+    }
+
+    // index is now relative to the first array entry
+    if (index >= _bulkStreamOffsets.size())
+        return false;
+
+    *temporalOffset = _bulkTemporalOffsets[index];
+    *keyFrameOffset = _bulkKeyFrameOffsets[index];
+    *flags = _bulkFlags[index];
+    *streamOffset = _bulkStreamOffsets[index];
+    if (sliceOffset)
+    {
+        sliceOffset->assign(_bulkSliceOffsets.begin() + (size_t)index * sliceCount,
+                            _bulkSliceOffsets.begin() + (size_t)(index + 1) * sliceCount);
+    }
+    if (posTable)
+    {
+        posTable->assign(_bulkPosTables.begin() + (size_t)index * posTableCount,
+                         _bulkPosTables.begin() + (size_t)(index + 1) * posTableCount);
+    }
+    return true;
+}
+
+// the delta and index entry arrays are serialized into a buffer and written in blocks rather than
+// writing each field through libMXF
+void IndexTableSegment::writeSegment(File *mxfFile)
+{
+    uint32_t numDeltaEntries = (uint32_t)_deltaEntries.size();
+    uint32_t numListIndexEntries = 0;
+    const ::MXFIndexEntry *indexEntry;
+    for (indexEntry = _cSegment->indexEntryArray; indexEntry; indexEntry = indexEntry->next)
+        numListIndexEntries++;
+    uint32_t numIndexEntries = numListIndexEntries + (uint32_t)_bulkStreamOffsets.size();
+
+    writeHeader(mxfFile, numDeltaEntries, numIndexEntries);
+
+    vector<uint8_t> buffer;
+    uint32_t i;
+
+    if (numDeltaEntries > 0)
+    {
+        writeDeltaEntryArrayHeader(mxfFile, numDeltaEntries);
+
+        buffer.resize(numDeltaEntries * DELTA_ENTRY_SIZE);
+        uint8_t *bytes = &buffer[0];
+        for (i = 0; i < numDeltaEntries; i++)
+        {
+            bytes[0] = (uint8_t)_deltaEntries[i].posTableIndex;
+            bytes[1] = _deltaEntries[i].slice;
+            store_be_uint32(&bytes[2], _deltaEntries[i].elementData);
+            bytes += DELTA_ENTRY_SIZE;
+        }
+        MXFPP_CHECK(mxfFile->write(&buffer[0], (uint32_t)buffer.size()) == buffer.size());
+    }
+
+    if (numIndexEntries > 0)
+    {
+        uint8_t sliceCount = _cSegment->sliceCount;
+        uint8_t posTableCount = _cSegment->posTableCount;
+        writeIndexEntryArrayHeader(mxfFile, sliceCount, posTableCount, numIndexEntries);
+
+        uint32_t entrySize = INDEX_ENTRY_BASE_SIZE + 4 * sliceCount + 8 * posTableCount;
+        uint32_t bufferEntries = INDEX_WRITE_BUFFER_SIZE / entrySize;
+        if (bufferEntries > numIndexEntries)
+            bufferEntries = numIndexEntries;
+        buffer.resize(bufferEntries * entrySize);
+
+        uint32_t count = 0;
+        uint8_t *bytes = &buffer[0];
+        for (indexEntry = _cSegment->indexEntryArray; indexEntry; indexEntry = indexEntry->next)
+        {
+            serialize_index_entry(bytes, indexEntry->temporalOffset, indexEntry->keyFrameOffset, indexEntry->flags,
+                                  indexEntry->streamOffset, indexEntry->sliceOffset, sliceCount,
+                                  indexEntry->posTable, posTableCount);
+            bytes += entrySize;
+            if (++count == bufferEntries)
+            {
+                MXFPP_CHECK(mxfFile->write(&buffer[0], count * entrySize) == count * entrySize);
+                bytes = &buffer[0];
+                count = 0;
+            }
+        }
+        for (i = 0; i < _bulkStreamOffsets.size(); i++)
+        {
+            serialize_index_entry(bytes, _bulkTemporalOffsets[i], _bulkKeyFrameOffsets[i], _bulkFlags[i],
+                                  _bulkStreamOffsets[i],
+                                  (sliceCount > 0 ? &_bulkSliceOffsets[i * sliceCount] : 0), sliceCount,
+                                  (posTableCount > 0 ? &_bulkPosTables[i * posTableCount] : 0), posTableCount);
+            bytes += entrySize;
+            if (++count == bufferEntries)
+            {
+                MXFPP_CHECK(mxfFile->write(&buffer[0], count * entrySize) == count * entrySize);
+                bytes = &buffer[0];
+                count = 0;
+            }
+        }
+        if (count > 0)
+            MXFPP_CHECK(mxfFile->write(&buffer[0], count * entrySize) == count * entrySize);
+    }
+}
+
 void IndexTableSegment::writeHeader(File *mxfFile, uint32_t numDeltaEntries, uint32_t numIndexEntries)
 {
     MXFPP_CHECK(mxf_write_index_table_segment_header(mxfFile->getCFile(), _cSegment, numDeltaEntries, numIndexEntries));
@@ -397,3 +645,445 @@ void IndexTableSegment::writeAvidIndexEntryArrayHeader(File *mxfFile, uint8_t sl
                                                         numIndexEntries));
 }
 
+
+
+
+StreamingIndexTableWriter::StreamingIndexTableWriter(uint32_t indexSID, uint32_t bodySID, mxfRational indexEditRate,
+                                                     uint32_t maxSegmentEntries)
+: _segment(0), _maxSegmentEntries(maxSegmentEntries), _segmentStartPosition(0)
+{
+    MXFPP_CHECK(maxSegmentEntries > 0);
+
+    _segment = new IndexTableSegment();
+    _segment->setIndexSID(indexSID);
+    _segment->setBodySID(bodySID);
+    _segment->setIndexEditRate(indexEditRate);
+    _segment->setEditUnitByteCount(0);
+    _segment->reserveIndexEntries(maxSegmentEntries);
+}
+
+StreamingIndexTableWriter::~StreamingIndexTableWriter()
+{
+    delete _segment;
+}
+
+void StreamingIndexTableWriter::setSliceCount(uint8_t value)
+{
+    MXFPP_CHECK(!havePendingEntries());
+    _segment->setSliceCount(value);
+}
+
+void StreamingIndexTableWriter::setPosTableCount(uint8_t value)
+{
+    MXFPP_CHECK(!havePendingEntries());
+    _segment->setPosTableCount(value);
+}
+
+void StreamingIndexTableWriter::appendDeltaEntry(int8_t posTableIndex, uint8_t slice, uint32_t elementData)
+{
+    _segment->appendDeltaEntry(posTableIndex, slice, elementData);
+}
+
+void StreamingIndexTableWriter::addIndexEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags,
+                                              uint64_t streamOffset, const uint32_t *sliceOffsets,
+                                              const mxfRational *posTable)
+{
+    MXFPP_CHECK((sliceOffsets || _segment->getSliceCount() == 0) &&
+                (posTable || _segment->getPosTableCount() == 0));
+
+    _segment->appendIndexEntries(1, &temporalOffset, &keyFrameOffset, &flags, &streamOffset, sliceOffsets,
+                                 posTable);
+}
+
+bool StreamingIndexTableWriter::isSegmentFull() const
+{
+    return getPendingEntryCount() >= _maxSegmentEntries;
+}
+
+bool StreamingIndexTableWriter::havePendingEntries() const
+{
+    return getPendingEntryCount() > 0;
+}
+
+uint32_t StreamingIndexTableWriter::getPendingEntryCount() const
+{
+    return _segment->getBulkIndexEntryCount();
+}
+
+void StreamingIndexTableWriter::writeSegment(File *mxfFile, Partition *partition, FillerWriter *filler)
+{
+    if (!havePendingEntries())
+        return;
+
+    mxfUUID uuid;
+    mxf_generate_uuid(&uuid);
+    _segment->setInstanceUID(uuid);
+    _segment->setIndexStartPosition(_segmentStartPosition);
+    _segment->setIndexDuration(getPendingEntryCount());
+
+    partition->setIndexSID(_segment->getIndexSID());
+    _segment->write(mxfFile, partition, filler);
+
+    _segmentStartPosition += getPendingEntryCount();
+    _segment->clearIndexEntries();
+}
+
+Partition& StreamingIndexTableWriter::writeIndexPartition(File *mxfFile, const mxfKey *partitionKey)
+{
+    Partition &partition = mxfFile->createPartition();
+    partition.setKey(partitionKey);
+    partition.setIndexSID(_segment->getIndexSID());
+    partition.setBodySID(0);
+    partition.setBodyOffset(0);
+    partition.write(mxfFile);
+
+    writeSegment(mxfFile, &partition, 0);
+
+    return partition;
+}
+
+
+
+IndexTable::IndexTable(uint32_t indexSID)
+: _indexSID(indexSID), _bodySID(0), _entriesValid(false)
+{
+}
+
+IndexTable::~IndexTable()
+{
+    size_t i;
+    for (i = 0; i < _segments.size(); i++)
+        delete _segments[i].segment;
+}
+
+void IndexTable::read(File *mxfFile)
+{
+    const vector<Partition*> &partitions = mxfFile->getPartitions();
+    uint16_t runinLen = mxf_get_runin_len(mxfFile->getCFile());
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    size_t i;
+
+    for (i = 0; i < partitions.size(); i++)
+    {
+        Partition *partition = partitions[i];
+        if (partition->getIndexSID() != _indexSID || partition->getIndexByteCount() == 0)
+            continue;
+
+        mxfFile->seek(runinLen + partition->getThisPartition(), SEEK_SET);
+        mxfFile->readKL(&key, &llen, &len);
+        mxfFile->skip(len);
+
+        // the header byte count starts at the primer pack key and includes the trailing fill
+        if (partition->getHeaderByteCount() > 0)
+        {
+            mxfFile->readNextNonFillerKL(&key, &llen, &len);
+            mxfFile->skip(partition->getHeaderByteCount() - mxfKey_extlen - llen);
+        }
+
+        mxfFile->readNextNonFillerKL(&key, &llen, &len);
+        int64_t indexEnd = mxfFile->tell() - mxfKey_extlen - llen + partition->getIndexByteCount();
+        while (true)
+        {
+            if (IndexTableSegment::isIndexTableSegment(&key))
+            {
+                IndexTableSegment *segment = IndexTableSegment::read(mxfFile, len);
+                if (segment->getIndexSID() == _indexSID)
+                    addSegment(segment, partition);
+                else
+                    delete segment;
+            }
+            else
+            {
+                mxfFile->skip(len);
+            }
+
+            if (mxfFile->tell() >= indexEnd)
+                break;
+            mxfFile->readNextNonFillerKL(&key, &llen, &len);
+        }
+    }
+
+    for (i = 0; i < partitions.size(); i++)
+    {
+        if (_bodySID != 0 && partitions[i]->getBodySID() == _bodySID)
+            addBodyPartition(partitions[i]);
+    }
+}
+
+void IndexTable::addSegment(IndexTableSegment *segment, Partition *partition)
+{
+    uint32_t indexSID = segment->getIndexSID();
+    if (indexSID != _indexSID)
+    {
+        delete segment;
+        throw MXFException("Index table segment IndexSID %u does not match %u", indexSID, _indexSID);
+    }
+    if (_bodySID == 0)
+        _bodySID = segment->getBodySID();
+
+    SegmentInfo info;
+    info.segment = segment;
+    info.partition = partition;
+    info.startPosition = segment->getIndexStartPosition();
+    info.duration = segment->getIndexDuration();
+    info.editUnitByteCount = segment->getEditUnitByteCount();
+
+    size_t i;
+    for (i = 0; i < _segments.size(); i++)
+    {
+        if (_segments[i].startPosition >= info.startPosition)
+            break;
+    }
+    if (i < _segments.size() && _segments[i].startPosition == info.startPosition)
+    {
+        if (_segments[i].duration >= info.duration)
+        {
+            delete segment;
+            return;
+        }
+        delete _segments[i].segment;
+        _segments[i] = info;
+    }
+    else
+    {
+        _segments.insert(_segments.begin() + i, info);
+    }
+
+    _entriesValid = false;
+}
+
+void IndexTable::addBodyPartition(Partition *partition)
+{
+    size_t i;
+    for (i = 0; i < _bodyPartitions.size(); i++)
+    {
+        if (_bodyPartitions[i] == partition)
+            return;
+        if (_bodyPartitions[i]->getBodyOffset() > partition->getBodyOffset())
+            break;
+    }
+    _bodyPartitions.insert(_bodyPartitions.begin() + i, partition);
+}
+
+IndexTableSegment* IndexTable::getSegment(size_t index) const
+{
+    MXFPP_CHECK(index < _segments.size());
+    return _segments[index].segment;
+}
+
+Partition* IndexTable::getSegmentPartition(size_t index) const
+{
+    MXFPP_CHECK(index < _segments.size());
+    return _segments[index].partition;
+}
+
+IndexTableSegment* IndexTable::getSegmentAt(int64_t position) const
+{
+    size_t index = findSegment(position);
+    if (index == (size_t)(-1))
+        return 0;
+
+    return _segments[index].segment;
+}
+
+int64_t IndexTable::getDuration() const
+{
+    if (_segments.empty())
+        return 0;
+
+    const SegmentInfo &last = _segments.back();
+    return last.startPosition + last.duration;
+}
+
+bool IndexTable::haveEntry(int64_t position) const
+{
+    return findSegment(position) != (size_t)(-1);
+}
+
+bool IndexTable::getEntry(int64_t position, Entry *entry) const
+{
+    size_t index = findSegment(position);
+    if (index == (size_t)(-1))
+        return false;
+
+    const SegmentInfo &info = _segments[index];
+    if (info.editUnitByteCount > 0)
+    {
+        entry->streamOffset = _cbrStreamOffsets[index] +
+                                (uint64_t)(position - info.startPosition) * info.editUnitByteCount;
+        entry->temporalOffset = 0;
+        entry->keyFrameOffset = 0;
+        entry->flags = 0x80; // random access
+    }
+    else
+    {
+        size_t entryIndex = _entryOffsets[index] + (size_t)(position - info.startPosition);
+        entry->streamOffset = _streamOffsets[entryIndex];
+        entry->temporalOffset = _temporalOffsets[entryIndex];
+        entry->keyFrameOffset = _keyFrameOffsets[entryIndex];
+        entry->flags = _flags[entryIndex];
+    }
+
+    entry->partition = findBodyPartition(entry->streamOffset);
+    if (entry->partition)
+        entry->partitionOffset = entry->streamOffset - entry->partition->getBodyOffset();
+    else
+        entry->partitionOffset = entry->streamOffset;
+
+    return true;
+}
+
+bool IndexTable::planSeek(int64_t displayPosition, SeekPlan *plan) const
+{
+    Entry entry;
+    if (!getEntry(displayPosition, &entry))
+        return false;
+
+    // the temporal offset in the entry at the display position gives the stored position
+    int64_t targetPosition = displayPosition + entry.temporalOffset;
+    Entry targetEntry;
+    if (!getEntry(targetPosition, &targetEntry))
+        return false;
+
+    // a key frame after the target is a corrupt KeyFrameOffset
+    int64_t keyFramePosition = targetPosition + targetEntry.keyFrameOffset;
+    Entry keyFrameEntry;
+    if (keyFramePosition > targetPosition || !getEntry(keyFramePosition, &keyFrameEntry))
+        return false;
+
+    plan->targetPosition = targetPosition;
+    plan->keyFramePosition = keyFramePosition;
+    plan->partition = keyFrameEntry.partition;
+    plan->editUnits.clear();
+
+    Entry unitEntry = keyFrameEntry;
+    int64_t position;
+    for (position = keyFramePosition; position <= targetPosition; position++)
+    {
+        Entry nextEntry;
+        bool haveNext = getEntry(position + 1, &nextEntry);
+
+        if (position == keyFramePosition || position == targetPosition || !(unitEntry.flags & 0x10))
+        {
+            EditUnitRange range;
+            range.position = position;
+            range.streamOffset = unitEntry.streamOffset;
+            range.size = (haveNext ? nextEntry.streamOffset - unitEntry.streamOffset : 0);
+            plan->editUnits.push_back(range);
+        }
+
+        if (!haveNext)
+            break;
+        unitEntry = nextEntry;
+    }
+
+    if (plan->editUnits.empty())
+        return false;
+
+    const EditUnitRange &last = plan->editUnits.back();
+    plan->readStreamOffset = keyFrameEntry.streamOffset;
+    plan->readSize = (last.size > 0 ? last.streamOffset + last.size - plan->readStreamOffset : 0);
+    plan->crossesPartition = false;
+    if (plan->partition && plan->readSize > 0)
+        plan->crossesPartition = (findBodyPartition(plan->readStreamOffset + plan->readSize - 1) != plan->partition);
+
+    return true;
+}
+
+size_t IndexTable::findSegment(int64_t position) const
+{
+    updateEntries();
+
+    vector<int64_t>::const_iterator iter = upper_bound(_segmentStarts.begin(), _segmentStarts.end(), position);
+    if (iter == _segmentStarts.begin())
+        return (size_t)(-1);
+
+    size_t index = (iter - _segmentStarts.begin()) - 1;
+    const SegmentInfo &info = _segments[index];
+    int64_t offset = position - info.startPosition;
+    if (info.editUnitByteCount > 0)
+    {
+        if (info.duration > 0 && offset >= info.duration)
+            return (size_t)(-1);
+    }
+    else
+    {
+        if (offset >= info.duration || offset >= (int64_t)(_entryOffsets[index + 1] - _entryOffsets[index]))
+            return (size_t)(-1);
+    }
+
+    return index;
+}
+
+void IndexTable::updateEntries() const
+{
+    if (_entriesValid)
+        return;
+
+    _segmentStarts.clear();
+    _cbrStreamOffsets.clear();
+    _entryOffsets.clear();
+    _streamOffsets.clear();
+    _temporalOffsets.clear();
+    _keyFrameOffsets.clear();
+    _flags.clear();
+
+    size_t i;
+    for (i = 0; i < _segments.size(); i++)
+    {
+        const SegmentInfo &info = _segments[i];
+        _segmentStarts.push_back(info.startPosition);
+        _entryOffsets.push_back(_streamOffsets.size());
+
+        // CBR stream offsets continue from a preceding adjacent CBR segment
+        uint64_t cbrOffset = (uint64_t)info.startPosition * info.editUnitByteCount;
+        if (i > 0 && _segments[i - 1].editUnitByteCount > 0 &&
+            _segments[i - 1].startPosition + _segments[i - 1].duration == info.startPosition)
+        {
+            cbrOffset = _cbrStreamOffsets[i - 1] +
+                            (uint64_t)_segments[i - 1].duration * _segments[i - 1].editUnitByteCount;
+        }
+        _cbrStreamOffsets.push_back(cbrOffset);
+
+        if (info.editUnitByteCount > 0)
+            continue;
+
+        const ::MXFIndexEntry *cEntry;
+        for (cEntry = info.segment->_cSegment->indexEntryArray; cEntry; cEntry = cEntry->next)
+        {
+            _streamOffsets.push_back(cEntry->streamOffset);
+            _temporalOffsets.push_back(cEntry->temporalOffset);
+            _keyFrameOffsets.push_back(cEntry->keyFrameOffset);
+            _flags.push_back(cEntry->flags);
+        }
+        _streamOffsets.insert(_streamOffsets.end(),
+                              info.segment->_bulkStreamOffsets.begin(), info.segment->_bulkStreamOffsets.end());
+        _temporalOffsets.insert(_temporalOffsets.end(),
+                                info.segment->_bulkTemporalOffsets.begin(), info.segment->_bulkTemporalOffsets.end());
+        _keyFrameOffsets.insert(_keyFrameOffsets.end(),
+                                info.segment->_bulkKeyFrameOffsets.begin(), info.segment->_bulkKeyFrameOffsets.end());
+        _flags.insert(_flags.end(), info.segment->_bulkFlags.begin(), info.segment->_bulkFlags.end());
+    }
+    _entryOffsets.push_back(_streamOffsets.size());
+
+    _entriesValid = true;
+}
+
+Partition* IndexTable::findBodyPartition(uint64_t streamOffset) const
+{
+    // binary search for the last partition with BodyOffset <= streamOffset
+    size_t low = 0;
+    size_t high = _bodyPartitions.size();
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (_bodyPartitions[mid]->getBodyOffset() <= streamOffset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return (low > 0 ? _bodyPartitions[low - 1] : 0);
+}
@@ -32,6 +32,7 @@
 #ifndef MXFPP_INDEX_TABLE_H_
 #define MXFPP_INDEX_TABLE_H_
 
+#include <unordered_map>
 #include <vector>
 
 
@@ -41,9 +42,13 @@ namespace mxfpp
 
 
 class File;
+class IndexTable;
 
 class IndexTableSegment
 {
+    friend class IndexTable;
+    friend class CompactIndexTable;
+
 public:
     static bool isIndexTableSegment(const mxfKey *key);
     static IndexTableSegment* read(File *mxfFile, uint64_t segmentLen);
@@ -69,6 +74,11 @@ public:
     mxfOptBool getForwardIndexDirection() const;
     // deltaEntryArray
     // indexEntryArray
+
+    // the delta entries are copied to an array with a (slice, delta) lookup when the segment is constructed
+    // or read and by appendDeltaEntry. The returned array is valid until the next appendDeltaEntry call.
+    // getDeltaEntryAtDelta returns the libMXF list entry
+    const std::vector<MXFDeltaEntry>& getDeltaEntries() const { return _deltaEntries; }
     bool haveDeltaEntryAtDelta(uint32_t delta, uint8_t slice) const;
     const MXFDeltaEntry* getDeltaEntryAtDelta(uint32_t delta, uint8_t slice) const;
 
@@ -93,6 +103,26 @@ public:
     void appendIndexEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags, uint64_t streamOffset,
         const std::vector<uint32_t> &sliceOffset, const std::vector<mxfRational> &posTable);
 
+    // appends count index entries from contiguous arrays. sliceOffsets has count * SliceCount values and
+    // posTables has count * PosTableCount values, and they can be null if the count is 0.
+    // The entries are stored in arrays rather than the libMXF entry list and are written after the list entries.
+    // Later calls to appendIndexEntry also append to the arrays
+    void appendIndexEntries(uint32_t count, const int8_t *temporalOffsets, const int8_t *keyFrameOffsets,
+                            const uint8_t *flags, const uint64_t *streamOffsets, const uint32_t *sliceOffsets,
+                            const mxfRational *posTables);
+    void reserveIndexEntries(uint32_t count);
+    uint32_t getBulkIndexEntryCount() const { return (uint32_t)_bulkStreamOffsets.size(); }
+
+    // the index entries in the libMXF entry list followed by the entries in the arrays.
+    // sliceOffset and posTable can be null. Returns false if the index is out of range
+    uint32_t getNumIndexEntries() const;
+    bool getIndexEntry(uint32_t index, int8_t *temporalOffset, int8_t *keyFrameOffset, uint8_t *flags,
+                       uint64_t *streamOffset, std::vector<uint32_t> *sliceOffset,
+                       std::vector<mxfRational> *posTable) const;
+
+    // removes and frees all the index entries. The delta entries are kept
+    void clearIndexEntries();
+
 
     void write(File *mxfFile, Partition *partition, FillerWriter *filler);
 
@@ -107,10 +137,162 @@ public:
     void writeAvidIndexEntryArrayHeader(File *mxfFile, uint8_t sliceCount, uint8_t posTableCount,
                                         uint32_t numIndexEntries);
 
+    // the libMXF indexEntryArray list doesn't include the entries added by appendIndexEntries or by later
+    // appendIndexEntry calls. Use getNumIndexEntries and getIndexEntry to access all the entries
     ::MXFIndexTableSegment* getCIndexTableSegment() const { return _cSegment; }
 
 protected:
     ::MXFIndexTableSegment* _cSegment;
+
+private:
+    void addDeltaEntryToArray(const MXFDeltaEntry *cEntry);
+    const MXFDeltaEntry* findDeltaEntry(uint32_t delta, uint8_t slice) const;
+
+    void writeSegment(File *mxfFile);
+
+    std::vector<MXFDeltaEntry> _deltaEntries;
+    std::unordered_map<uint64_t, const MXFDeltaEntry*> _deltaEntryIndex;
+    const MXFDeltaEntry *_lastDeltaEntry;
+
+    std::vector<int8_t> _bulkTemporalOffsets;
+    std::vector<int8_t> _bulkKeyFrameOffsets;
+    std::vector<uint8_t> _bulkFlags;
+    std::vector<uint64_t> _bulkStreamOffsets;
+    std::vector<uint32_t> _bulkSliceOffsets;
+    std::vector<mxfRational> _bulkPosTables;
+};
+
+
+// writes VBR index table segments of up to maxSegmentEntries entries as the essence is written so that the
+// index entries held in memory are bounded by the segment size
+class StreamingIndexTableWriter
+{
+public:
+    StreamingIndexTableWriter(uint32_t indexSID, uint32_t bodySID, mxfRational indexEditRate,
+                              uint32_t maxSegmentEntries);
+    ~StreamingIndexTableWriter();
+
+    void setSliceCount(uint8_t value);
+    void setPosTableCount(uint8_t value);
+    void appendDeltaEntry(int8_t posTableIndex, uint8_t slice, uint32_t elementData);
+
+    // sliceOffsets has SliceCount values and posTable has PosTableCount values
+    void addIndexEntry(int8_t temporalOffset, int8_t keyFrameOffset, uint8_t flags, uint64_t streamOffset,
+                       const uint32_t *sliceOffsets = 0, const mxfRational *posTable = 0);
+
+    bool isSegmentFull() const;
+    bool havePendingEntries() const;
+    uint32_t getPendingEntryCount() const;
+    int64_t getDuration() const { return _segmentStartPosition + getPendingEntryCount(); }
+
+    // writes the pending entries as a segment in the partition, which must be the last partition written,
+    // e.g. a body partition before its essence data or the footer partition. The partition's IndexSID is
+    // set and the pending entries are freed
+    void writeSegment(File *mxfFile, Partition *partition, FillerWriter *filler = 0);
+
+    // creates and writes an index-only partition (BodySID 0) containing the pending entries
+    Partition& writeIndexPartition(File *mxfFile, const mxfKey *partitionKey);
+
+private:
+    IndexTableSegment *_segment;
+    uint32_t _maxSegmentEntries;
+    int64_t _segmentStartPosition;
+};
+
+
+// aggregates the index table segments with the same IndexSID across partitions
+class IndexTable
+{
+public:
+    typedef struct
+    {
+        Partition *partition;       // partition containing the edit unit or 0 if unknown
+        uint64_t streamOffset;      // offset in the essence container stream
+        uint64_t partitionOffset;   // offset relative to the partition's BodyOffset
+        int8_t temporalOffset;
+        int8_t keyFrameOffset;
+        uint8_t flags;
+    } Entry;
+
+    typedef struct
+    {
+        int64_t position;           // stored (decode) order position
+        uint64_t streamOffset;
+        uint64_t size;              // 0 if unknown, i.e. the last indexed VBR edit unit
+    } EditUnitRange;
+
+    typedef struct
+    {
+        int64_t targetPosition;     // stored order position of the requested display order frame
+        int64_t keyFramePosition;
+        Partition *partition;       // partition containing the key frame or 0 if unknown
+        bool crossesPartition;      // the read range extends into a following body partition
+        std::vector<EditUnitRange> editUnits;   // edit units to decode, in decode order, from the key frame
+        uint64_t readStreamOffset;  // a single read covering all edit units in the plan
+        uint64_t readSize;          // 0 if the size of the target edit unit is unknown
+    } SeekPlan;
+
+public:
+    IndexTable(uint32_t indexSID);
+    ~IndexTable();
+
+    // reads the index table segments from all the partitions with a matching IndexSID
+    void read(File *mxfFile);
+
+    // takes ownership of the segment. Duplicate segments that are found in multiple partitions are replaced
+    // by the one with the longest duration
+    void addSegment(IndexTableSegment *segment, Partition *partition);
+
+    // the body partitions are used to map stream offsets to partitions
+    void addBodyPartition(Partition *partition);
+
+    uint32_t getIndexSID() const { return _indexSID; }
+    uint32_t getBodySID() const { return _bodySID; }
+    size_t getNumSegments() const { return _segments.size(); }
+    IndexTableSegment* getSegment(size_t index) const;
+    Partition* getSegmentPartition(size_t index) const;
+    IndexTableSegment* getSegmentAt(int64_t position) const;
+
+    // end position of the last segment. CBR segments with a zero duration cover all following positions
+    int64_t getDuration() const;
+
+    bool haveEntry(int64_t position) const;
+    bool getEntry(int64_t position, Entry *entry) const;
+
+    // plans a frame accurate seek to a display order position using the temporal and key frame offsets.
+    // The plan includes the key frame, the reference frames between the key frame and the target and the
+    // target frame itself. Non-reference (backward predicted) frames are skipped.
+    // Returns false if an entry is missing or the key frame offset points after the target
+    bool planSeek(int64_t displayPosition, SeekPlan *plan) const;
+
+private:
+    typedef struct
+    {
+        IndexTableSegment *segment;
+        Partition *partition;
+        int64_t startPosition;
+        int64_t duration;
+        uint32_t editUnitByteCount;
+    } SegmentInfo;
+
+    size_t findSegment(int64_t position) const;
+    void updateEntries() const;
+    Partition* findBodyPartition(uint64_t streamOffset) const;
+
+private:
+    uint32_t _indexSID;
+    uint32_t _bodySID;
+    std::vector<SegmentInfo> _segments;
+    std::vector<Partition*> _bodyPartitions;
+
+    mutable bool _entriesValid;
+    mutable std::vector<int64_t> _segmentStarts;
+    mutable std::vector<uint64_t> _cbrStreamOffsets;
+    mutable std::vector<size_t> _entryOffsets;
+    mutable std::vector<uint64_t> _streamOffsets;
+    mutable std::vector<int8_t> _temporalOffsets;
+    mutable std::vector<int8_t> _keyFrameOffsets;
+    mutable std::vector<uint8_t> _flags;
 };
 
 
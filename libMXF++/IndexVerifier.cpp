@@ -0,0 +1,527 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <thread>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define MAX_CODEC_PREFIX_SIZE   4
+
+
+typedef struct
+{
+    int64_t essenceStart;
+    int64_t valueStart;
+    int64_t valueEnd;
+} PartitionEssenceInfo;
+
+typedef struct
+{
+    const IndexTable *indexTable;
+    map<const Partition*, PartitionEssenceInfo> partitionInfo;
+    int64_t fileSize;
+    bool isClipWrapped;
+    mxfKey editUnitKey;
+    uint8_t codecPrefix[MAX_CODEC_PREFIX_SIZE];
+    uint32_t codecPrefixSize;
+} VerifyContext;
+
+typedef struct
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+} KLHeader;
+
+
+
+static double elapsed_seconds(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bool read_kl_at(MXFFile *cFile, int64_t fileSize, int64_t position, KLHeader *kl)
+{
+    const uint8_t *bytes = (const uint8_t*)&kl->key;
+    return position + mxfKey_extlen + 1 <= fileSize &&
+           mxf_file_seek(cFile, position, SEEK_SET) &&
+           mxf_read_kl(cFile, &kl->key, &kl->llen, &kl->len) &&
+           bytes[0] == 0x06 && bytes[1] == 0x0e && bytes[2] == 0x2b && bytes[3] == 0x34;
+}
+
+static bool read_bytes_at(MXFFile *cFile, int64_t position, uint8_t *bytes, uint32_t size)
+{
+    return mxf_file_seek(cFile, position, SEEK_SET) && mxf_file_read(cFile, bytes, size) == size;
+}
+
+static uint32_t get_codec_prefix_size(const uint8_t *bytes)
+{
+    if (bytes[0] == 0x00 && bytes[1] == 0x00 && bytes[2] == 0x00 && bytes[3] == 0x01)
+        return 4;   // AVC/HEVC Annex B start code
+    if (bytes[0] == 0x00 && bytes[1] == 0x00 && bytes[2] == 0x01)
+        return 3;   // MPEG start code
+    if (bytes[0] == 0xff && bytes[1] == 0xd8)
+        return 2;   // JPEG SOI
+    if (bytes[0] == 0x1f && bytes[1] == 0x07)
+        return 2;   // DV header DIF block
+
+    return 0;
+}
+
+
+
+// Utility class to verify a contiguous range of edit units in a separate thread
+class EditUnitVerifier
+{
+public:
+    EditUnitVerifier()
+    {
+        _context = 0;
+        _start = 0;
+        _end = 0;
+        _maxMismatches = 0;
+        _failed = false;
+    }
+
+    void init(const string &filename, const VerifyContext *context, int64_t start, int64_t end,
+              size_t maxMismatches)
+    {
+        _filename = filename;
+        _context = context;
+        _start = start;
+        _end = end;
+        _maxMismatches = maxMismatches;
+    }
+
+    void verify()
+    {
+        try
+        {
+            auto_ptr<File> file(File::openRead(_filename));
+
+            int64_t position;
+            for (position = _start;
+                 position < _end && (_maxMismatches == 0 || _mismatches.size() < _maxMismatches);
+                 position++) {
+                if (_context->isClipWrapped)
+                    verifyClipWrapped(file->getCFile(), position);
+                else
+                    verifyFrameWrapped(file->getCFile(), position);
+            }
+        }
+        catch (...)
+        {
+            _failed = true;
+        }
+    }
+
+    const vector<IndexVerifier::Mismatch>& getMismatches() const { return _mismatches; }
+    bool failed() const { return _failed; }
+
+private:
+    bool getFilePosition(int64_t position, IndexTable::Entry *entry, int64_t *filePosition,
+                         const PartitionEssenceInfo **info)
+    {
+        if (!_context->indexTable->getEntry(position, entry)) {
+            addMismatch(position, IndexVerifier::NO_ENTRY, 0, -1);
+            return false;
+        }
+
+        map<const Partition*, PartitionEssenceInfo>::const_iterator iter =
+            _context->partitionInfo.find(entry->partition);
+        if (iter == _context->partitionInfo.end()) {
+            addMismatch(position, IndexVerifier::NO_PARTITION, entry->streamOffset, -1);
+            return false;
+        }
+
+        *info = &iter->second;
+        if (_context->isClipWrapped)
+            *filePosition = iter->second.valueStart + (int64_t)entry->partitionOffset;
+        else
+            *filePosition = iter->second.essenceStart + (int64_t)entry->partitionOffset;
+        return true;
+    }
+
+    void verifyFrameWrapped(MXFFile *cFile, int64_t position)
+    {
+        IndexTable::Entry entry;
+        int64_t file_position;
+        const PartitionEssenceInfo *info;
+        if (!getFilePosition(position, &entry, &file_position, &info))
+            return;
+
+        KLHeader kl;
+        if (!read_kl_at(cFile, _context->fileSize, file_position, &kl)) {
+            addMismatch(position, IndexVerifier::NO_KLV_AT_OFFSET, entry.streamOffset, file_position);
+            return;
+        }
+        if (!(kl.key == _context->editUnitKey)) {
+            addMismatch(position, IndexVerifier::EDIT_UNIT_KEY_MISMATCH, entry.streamOffset, file_position);
+            return;
+        }
+
+        // the edit unit ends at the EditUnitByteCount or at the next entry if it is in the same partition
+        const IndexTableSegment *segment = _context->indexTable->getSegmentAt(position);
+        int64_t end = -1;
+        IndexTable::Entry next_entry;
+        if (segment && segment->getEditUnitByteCount() > 0)
+            end = file_position + segment->getEditUnitByteCount();
+        else if (_context->indexTable->getEntry(position + 1, &next_entry) && next_entry.partition == entry.partition)
+            end = file_position + (int64_t)(next_entry.streamOffset - entry.streamOffset);
+
+        // if the end is unknown then the edit unit ends at the next edit unit or partition
+        vector<uint32_t> element_offsets;
+        int64_t klv_position = file_position;
+        while (end < 0 || klv_position < end) {
+            if (!read_kl_at(cFile, _context->fileSize, klv_position, &kl))
+                break;
+            if (end < 0 && klv_position > file_position &&
+                (kl.key == _context->editUnitKey || mxf_is_partition_pack(&kl.key)))
+            {
+                break;
+            }
+            if (!mxf_is_filler(&kl.key))
+                element_offsets.push_back((uint32_t)(klv_position - file_position));
+            klv_position += mxfKey_extlen + kl.llen + (int64_t)kl.len;
+        }
+        if (end >= 0 && klv_position != end) {
+            addMismatch(position, IndexVerifier::EDIT_UNIT_SIZE_MISMATCH, entry.streamOffset, file_position);
+            return;
+        }
+
+        if (segment) {
+            const vector<MXFDeltaEntry> &delta_entries = segment->getDeltaEntries();
+            if (delta_entries.size() > 1) {
+                size_t i;
+                for (i = 0; i < delta_entries.size(); i++) {
+                    if (delta_entries[i].slice != 0)
+                        break;
+                    if (i >= element_offsets.size() || delta_entries[i].elementData != element_offsets[i]) {
+                        addMismatch(position, IndexVerifier::DELTA_ENTRY_MISMATCH, entry.streamOffset,
+                                    file_position);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    void verifyClipWrapped(MXFFile *cFile, int64_t position)
+    {
+        IndexTable::Entry entry;
+        int64_t file_position;
+        const PartitionEssenceInfo *info;
+        if (!getFilePosition(position, &entry, &file_position, &info))
+            return;
+
+        if (file_position >= info->valueEnd) {
+            addMismatch(position, IndexVerifier::OFFSET_OUT_OF_RANGE, entry.streamOffset, file_position);
+            return;
+        }
+
+        const IndexTableSegment *segment = _context->indexTable->getSegmentAt(position);
+        if (segment && segment->getEditUnitByteCount() > 0 &&
+            file_position + segment->getEditUnitByteCount() > info->valueEnd)
+        {
+            addMismatch(position, IndexVerifier::EDIT_UNIT_SIZE_MISMATCH, entry.streamOffset, file_position);
+            return;
+        }
+
+        if (_context->codecPrefixSize > 0) {
+            uint8_t prefix[MAX_CODEC_PREFIX_SIZE];
+            if (!read_bytes_at(cFile, file_position, prefix, _context->codecPrefixSize) ||
+                memcmp(prefix, _context->codecPrefix, _context->codecPrefixSize) != 0)
+            {
+                addMismatch(position, IndexVerifier::CODEC_BOUNDARY_MISMATCH, entry.streamOffset, file_position);
+            }
+        }
+    }
+
+    void addMismatch(int64_t position, IndexVerifier::MismatchType type, uint64_t streamOffset,
+                     int64_t filePosition)
+    {
+        IndexVerifier::Mismatch mismatch;
+        mismatch.position = position;
+        mismatch.type = type;
+        mismatch.streamOffset = streamOffset;
+        mismatch.filePosition = filePosition;
+        _mismatches.push_back(mismatch);
+    }
+
+private:
+    string _filename;
+    const VerifyContext *_context;
+    int64_t _start;
+    int64_t _end;
+    size_t _maxMismatches;
+    vector<IndexVerifier::Mismatch> _mismatches;
+    bool _failed;
+};
+
+
+static bool mismatch_position_less(const IndexVerifier::Mismatch &left, const IndexVerifier::Mismatch &right)
+{
+    return left.position < right.position;
+}
+
+
+
+const char* IndexVerifier::getMismatchTypeString(MismatchType type)
+{
+    switch (type)
+    {
+        case NO_ENTRY:                  return "no index entry";
+        case NO_PARTITION:              return "stream offset not in a body partition";
+        case NO_KLV_AT_OFFSET:          return "no KLV at offset";
+        case EDIT_UNIT_KEY_MISMATCH:    return "edit unit key mismatch";
+        case EDIT_UNIT_SIZE_MISMATCH:   return "edit unit size mismatch";
+        case DELTA_ENTRY_MISMATCH:      return "delta entry mismatch";
+        case OFFSET_OUT_OF_RANGE:       return "offset out of range";
+        case CODEC_BOUNDARY_MISMATCH:   return "codec boundary mismatch";
+    }
+
+    return "unknown";
+}
+
+IndexVerifier::IndexVerifier(const string &filename)
+{
+    _filename = filename;
+    _numThreads = 0;
+    _maxMismatches = 1000;
+    _indexSID = 0;
+    _numEditUnits = 0;
+    _isClipWrapped = false;
+    _indexReadTime = 0.0;
+    _verifyTime = 0.0;
+}
+
+IndexVerifier::~IndexVerifier()
+{
+}
+
+void IndexVerifier::setNumThreads(unsigned int numThreads)
+{
+    _numThreads = numThreads;
+}
+
+void IndexVerifier::setMaxMismatches(size_t maxMismatches)
+{
+    _maxMismatches = maxMismatches;
+}
+
+bool IndexVerifier::verify(uint32_t indexSID)
+{
+    _mismatches.clear();
+    _numEditUnits = 0;
+    _isClipWrapped = false;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    auto_ptr<File> file(File::openRead(_filename));
+    if (!file->readPartitions())
+        throw MXFException("Failed to read partitions from '%s'", _filename.c_str());
+    const vector<Partition*> &partitions = file->getPartitions();
+    size_t i;
+
+    _indexSID = indexSID;
+    for (i = 0; _indexSID == 0 && i < partitions.size(); i++)
+        _indexSID = partitions[i]->getIndexSID();
+    if (_indexSID == 0)
+        throw MXFException("File '%s' has no index table", _filename.c_str());
+
+    IndexTable index_table(_indexSID);
+    index_table.read(file.get());
+    _numEditUnits = index_table.getDuration();
+    // getEntry also builds the index table's entry arrays before they are used by multiple threads
+    IndexTable::Entry first_entry;
+    if (index_table.getNumSegments() == 0 || !index_table.getEntry(0, &first_entry))
+        throw MXFException("No index table segments with IndexSID %u", _indexSID);
+
+    // a CBR segment with a zero duration covers all the essence and the count is calculated below
+    const IndexTableSegment *last_segment = index_table.getSegment(index_table.getNumSegments() - 1);
+    if (last_segment->getEditUnitByteCount() > 0 && last_segment->getIndexDuration() == 0)
+        _numEditUnits = 0;
+
+
+    // locate the essence in each body partition
+
+    VerifyContext context;
+    context.indexTable = &index_table;
+    context.fileSize = file->size();
+    context.isClipWrapped = false;
+    context.codecPrefixSize = 0;
+    uint16_t runin_len = mxf_get_runin_len(file->getCFile());
+    uint64_t essence_size = 0;
+    for (i = 0; i < partitions.size(); i++) {
+        Partition *partition = partitions[i];
+        if (partition->getBodySID() != index_table.getBodySID())
+            continue;
+
+        try
+        {
+            mxfKey key;
+            uint8_t llen;
+            uint64_t len;
+            file->seek(runin_len + partition->getThisPartition(), SEEK_SET);
+            file->readKL(&key, &llen, &len);
+            file->skip(len);
+            if (partition->getHeaderByteCount() > 0) {
+                file->readNextNonFillerKL(&key, &llen, &len);
+                file->skip(partition->getHeaderByteCount() - mxfKey_extlen - llen);
+            }
+            if (partition->getIndexByteCount() > 0) {
+                file->readNextNonFillerKL(&key, &llen, &len);
+                file->seek(file->tell() - mxfKey_extlen - llen + partition->getIndexByteCount(), SEEK_SET);
+            }
+            file->readNextNonFillerKL(&key, &llen, &len);
+            if (mxf_is_partition_pack(&key))
+                continue;
+
+            PartitionEssenceInfo info;
+            info.valueStart = file->tell();
+            info.essenceStart = info.valueStart - mxfKey_extlen - llen;
+            info.valueEnd = info.valueStart + (int64_t)len;
+            context.partitionInfo[partition] = info;
+            index_table.addBodyPartition(partition);
+
+            // frame wrapped essence extends to the next partition or the end of the file
+            int64_t essence_end = context.fileSize;
+            if (i + 1 < partitions.size())
+                essence_end = runin_len + partitions[i + 1]->getThisPartition();
+            if (essence_end > info.essenceStart)
+                essence_size += (uint64_t)(essence_end - info.essenceStart);
+        }
+        catch (...)
+        {
+            // no essence in the partition
+        }
+    }
+    if (context.partitionInfo.empty())
+        throw MXFException("Failed to find the essence for BodySID %u", index_table.getBodySID());
+
+
+    // determine the wrapping from the size of the first essence KLV and the first edit unit
+
+    map<const Partition*, PartitionEssenceInfo>::const_iterator first_info =
+        context.partitionInfo.find(first_entry.partition);
+    if (first_info == context.partitionInfo.end())
+        first_info = context.partitionInfo.begin();
+    const IndexTableSegment *first_segment = index_table.getSegment(0);
+    uint64_t first_edit_unit_size = first_segment->getEditUnitByteCount();
+    IndexTable::Entry second_entry;
+    if (first_edit_unit_size == 0 && index_table.getEntry(1, &second_entry))
+        first_edit_unit_size = second_entry.streamOffset - first_entry.streamOffset;
+    int64_t first_edit_unit_position = first_info->second.essenceStart + (int64_t)first_entry.partitionOffset;
+    context.isClipWrapped = (first_entry.partitionOffset == 0 && first_edit_unit_size > 0 &&
+                             first_info->second.valueEnd > first_edit_unit_position + (int64_t)first_edit_unit_size);
+
+    if (_numEditUnits == 0) {
+        if (first_edit_unit_size == 0)
+            throw MXFException("Unable to determine the number of edit units");
+        const PartitionEssenceInfo &info = first_info->second;
+        if (context.isClipWrapped)
+            _numEditUnits = (info.valueEnd - info.valueStart) / (int64_t)first_edit_unit_size;
+        else
+            _numEditUnits = (int64_t)(essence_size / first_edit_unit_size);
+        if (_numEditUnits == 0)
+            throw MXFException("No complete edit units in the essence for BodySID %u", index_table.getBodySID());
+    }
+
+    KLHeader kl;
+    if (context.isClipWrapped) {
+        uint8_t prefix[MAX_CODEC_PREFIX_SIZE];
+        if (first_info->second.valueEnd - first_info->second.valueStart >= MAX_CODEC_PREFIX_SIZE &&
+            read_bytes_at(file->getCFile(), first_info->second.valueStart, prefix, MAX_CODEC_PREFIX_SIZE))
+        {
+            context.codecPrefixSize = get_codec_prefix_size(prefix);
+            memcpy(context.codecPrefix, prefix, sizeof(prefix));
+        }
+    } else {
+        if (!read_kl_at(file->getCFile(), context.fileSize, first_edit_unit_position, &kl))
+            throw MXFException("First edit unit is not at a KLV");
+        context.editUnitKey = kl.key;
+    }
+
+    _indexReadTime = elapsed_seconds(start);
+
+
+    // verify the edit units in parallel
+
+    start = chrono::steady_clock::now();
+
+    unsigned int numThreads = _numThreads;
+    if (numThreads == 0)
+        numThreads = thread::hardware_concurrency();
+    if (numThreads == 0)
+        numThreads = 1;
+    if (numThreads > _numEditUnits)
+        numThreads = (_numEditUnits > 0 ? (unsigned int)_numEditUnits : 1);
+
+    vector<EditUnitVerifier> verifiers(numThreads);
+    int64_t begin = 0;
+    int64_t end;
+    for (i = 0; i < numThreads; i++) {
+        end = begin + (_numEditUnits - begin) / (numThreads - i);
+        verifiers[i].init(_filename, &context, begin, end, _maxMismatches);
+        begin = end;
+    }
+
+    vector<thread> threads;
+    for (i = 1; i < numThreads; i++)
+        threads.push_back(thread(&EditUnitVerifier::verify, &verifiers[i]));
+    verifiers[0].verify();
+    for (i = 0; i < threads.size(); i++)
+        threads[i].join();
+
+    for (i = 0; i < numThreads; i++) {
+        if (verifiers[i].failed())
+            throw MXFException("Failed to verify index entries");
+        _mismatches.insert(_mismatches.end(), verifiers[i].getMismatches().begin(),
+                           verifiers[i].getMismatches().end());
+    }
+    stable_sort(_mismatches.begin(), _mismatches.end(), mismatch_position_less);
+
+    _verifyTime = elapsed_seconds(start);
+
+    return _mismatches.empty();
+}
+
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_INDEX_VERIFIER_H_
+#define MXFPP_INDEX_VERIFIER_H_
+
+#include <string>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+// checks the index entries of a file against the essence data. The edit units are split into ranges that are
+// verified in parallel, with each thread using its own File
+class IndexVerifier
+{
+public:
+    typedef enum
+    {
+        NO_ENTRY,                   // the index does not have an entry for the edit unit
+        NO_PARTITION,               // the stream offset is not in a body partition
+        NO_KLV_AT_OFFSET,           // frame wrapped: the stream offset does not land on a KLV key
+        EDIT_UNIT_KEY_MISMATCH,     // frame wrapped: the first KLV differs from the first edit unit's key
+        EDIT_UNIT_SIZE_MISMATCH,    // the KLVs do not end on the next edit unit or the EditUnitByteCount
+        DELTA_ENTRY_MISMATCH,       // frame wrapped: an element does not start at its delta entry offset
+        OFFSET_OUT_OF_RANGE,        // clip wrapped: the offset is outside the essence KLV value
+        CODEC_BOUNDARY_MISMATCH     // clip wrapped: the edit unit does not start with the codec start code
+    } MismatchType;
+
+    typedef struct
+    {
+        int64_t position;
+        MismatchType type;
+        uint64_t streamOffset;
+        int64_t filePosition;       // -1 if unknown
+    } Mismatch;
+
+    static const char* getMismatchTypeString(MismatchType type);
+
+public:
+    IndexVerifier(const std::string &filename);
+    ~IndexVerifier();
+
+    // numThreads 0 selects the number of hardware threads
+    void setNumThreads(unsigned int numThreads);
+    // the number of mismatches reported per thread. 0 reports all mismatches
+    void setMaxMismatches(size_t maxMismatches);
+
+    // indexSID 0 selects the IndexSID of the first partition that has one
+    // returns true if no mismatches were found
+    bool verify(uint32_t indexSID = 0);
+
+    uint32_t getIndexSID() const { return _indexSID; }
+    int64_t getNumEditUnits() const { return _numEditUnits; }
+    bool isClipWrapped() const { return _isClipWrapped; }
+    const std::vector<Mismatch>& getMismatches() const { return _mismatches; }
+
+    double getIndexReadTime() const { return _indexReadTime; }
+    double getVerifyTime() const { return _verifyTime; }
+
+private:
+    std::string _filename;
+    unsigned int _numThreads;
+    size_t _maxMismatches;
+
+    uint32_t _indexSID;
+    int64_t _numEditUnits;
+    bool _isClipWrapped;
+    std::vector<Mismatch> _mismatches;
+    double _indexReadTime;
+    double _verifyTime;
+};
+
+
+};
+
+
+
+#endif
+
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_ITEM_DESCRIPTOR_H_
+#define MXFPP_ITEM_DESCRIPTOR_H_
+
+
+
+namespace mxfpp
+{
+
+
+// Encoding of fixed size item values. The integer types are decoded inline
+
+template <typename T>
+class ItemValueTraits;
+
+#define MXFPP_INT_ITEM_VALUE_TRAITS(type, sz) \
+    template <> \
+    class ItemValueTraits<type> \
+    { \
+    public: \
+        enum { SIZE = sz }; \
+        static void decode(const uint8_t *data, type *value) \
+        { \
+            uint64_t v = 0; \
+            int i; \
+            for (i = 0; i < sz; i++) \
+                v = (v << 8) | data[i]; \
+            *value = (type)v; \
+        } \
+        static void encode(type value, uint8_t *data) \
+        { \
+            uint64_t v = (uint64_t)value; \
+            int i; \
+            for (i = sz - 1; i >= 0; i--) \
+            { \
+                data[i] = (uint8_t)(v & 0xff); \
+                v >>= 8; \
+            } \
+        } \
+    };
+
+MXFPP_INT_ITEM_VALUE_TRAITS(uint8_t, 1)
+MXFPP_INT_ITEM_VALUE_TRAITS(uint16_t, 2)
+MXFPP_INT_ITEM_VALUE_TRAITS(uint32_t, 4)
+MXFPP_INT_ITEM_VALUE_TRAITS(uint64_t, 8)
+MXFPP_INT_ITEM_VALUE_TRAITS(int8_t, 1)
+MXFPP_INT_ITEM_VALUE_TRAITS(int16_t, 2)
+MXFPP_INT_ITEM_VALUE_TRAITS(int32_t, 4)
+MXFPP_INT_ITEM_VALUE_TRAITS(int64_t, 8)
+
+template <>
+class ItemValueTraits<bool>
+{
+public:
+    enum { SIZE = 1 };
+    static void decode(const uint8_t *data, bool *value) { *value = (data[0] != 0); }
+    static void encode(bool value, uint8_t *data) { data[0] = (value ? 1 : 0); }
+};
+
+template <>
+class ItemValueTraits<mxfRational>
+{
+public:
+    enum { SIZE = 8 };
+    static void decode(const uint8_t *data, mxfRational *value) { mxf_get_rational(data, value); }
+    static void encode(mxfRational value, uint8_t *data) { mxf_set_rational(&value, data); }
+};
+
+template <>
+class ItemValueTraits<mxfTimestamp>
+{
+public:
+    enum { SIZE = 8 };
+    static void decode(const uint8_t *data, mxfTimestamp *value) { mxf_get_timestamp(data, value); }
+    static void encode(mxfTimestamp value, uint8_t *data) { mxf_set_timestamp(&value, data); }
+};
+
+template <>
+class ItemValueTraits<mxfUUID>
+{
+public:
+    enum { SIZE = mxfUUID_extlen };
+    static void decode(const uint8_t *data, mxfUUID *value) { mxf_get_uuid(data, value); }
+    static void encode(mxfUUID value, uint8_t *data) { mxf_set_uuid(&value, data); }
+};
+
+template <>
+class ItemValueTraits<mxfUL>
+{
+public:
+    enum { SIZE = mxfUL_extlen };
+    static void decode(const uint8_t *data, mxfUL *value) { mxf_get_ul(data, value); }
+    static void encode(mxfUL value, uint8_t *data) { mxf_set_ul(&value, data); }
+};
+
+template <>
+class ItemValueTraits<mxfUMID>
+{
+public:
+    enum { SIZE = mxfUMID_extlen };
+    static void decode(const uint8_t *data, mxfUMID *value) { mxf_get_umid(data, value); }
+    static void encode(mxfUMID value, uint8_t *data) { mxf_set_umid(&value, data); }
+};
+
+
+// Compile-time description of a fixed size metadata item, emitted by gen_metadata_classes for each set class.
+// Sub-classes provide a static key() function. The local tag is the data model's static tag and is only used as
+// a lookup hint; the item key is always checked. A local tag of 0 indicates a dynamic tag.
+
+template <typename T, mxfLocalTag TAG>
+class ItemDescriptor
+{
+public:
+    typedef T ValueType;
+    typedef ItemValueTraits<T> Traits;
+
+    static const mxfLocalTag localTag = TAG;
+    static const uint16_t size = Traits::SIZE;
+};
+
+
+};
+
+
+
+#endif
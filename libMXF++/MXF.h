@@ -42,12 +42,22 @@
 #include <libMXF++/File.h>
 #include <libMXF++/Partition.h>
 #include <libMXF++/IndexTable.h>
+#include <libMXF++/CompactIndexTable.h>
+#include <libMXF++/MappedIndexTableSegment.h>
+#include <libMXF++/IndexRecovery.h>
+#include <libMXF++/IndexVerifier.h>
 #include <libMXF++/DataModel.h>
+#include <libMXF++/MemoryArena.h>
+#include <libMXF++/ItemDescriptor.h>
+#include <libMXF++/metadata/MetadataSetKind.h>
 #include <libMXF++/MetadataSet.h>
 #include <libMXF++/HeaderMetadata.h>
 #include <libMXF++/AvidHeaderMetadata.h>
 
 #include <libMXF++/metadata/Metadata.h>
+#include <libMXF++/metadata/MetadataSetVisitor.h>
+#include <libMXF++/PackageGraph.h>
+#include <libMXF++/HeaderMetadataTemplate.h>
 
 
 
@@ -41,36 +41,6 @@ using namespace std;
 
 
 
-bool operator == (const mxfKey &left, const mxfKey &right)
-{
-    return memcmp(&left, &right, sizeof(left)) == 0;
-}
-
-bool operator != (const mxfKey &left, const mxfKey &right)
-{
-    return memcmp(&left, &right, sizeof(left)) != 0;
-}
-
-bool operator < (const mxfKey &left, const mxfKey &right)
-{
-    return memcmp(&left, &right, sizeof(left)) < 0;
-}
-
-bool operator == (const mxfUUID &left, const mxfUUID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) == 0;
-}
-
-bool operator != (const mxfUUID &left, const mxfUUID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) != 0;
-}
-
-bool operator < (const mxfUUID &left, const mxfUUID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) < 0;
-}
-
 bool operator == (const mxfRational &left, const mxfRational &right)
 {
     if (left.numerator == 0)
@@ -86,21 +56,6 @@ bool operator != (const mxfRational &left, const mxfRational &right)
     return !(left == right);
 }
 
-bool operator == (const mxfUMID &left, const mxfUMID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) == 0;
-}
-
-bool operator != (const mxfUMID &left, const mxfUMID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) != 0;
-}
-
-bool operator < (const mxfUMID &left, const mxfUMID &right)
-{
-    return memcmp(&left, &right, sizeof(left)) < 0;
-}
-
 bool operator == (const mxfExtendedUMID &left, const mxfExtendedUMID &right)
 {
     return memcmp(left.bytes, right.bytes, sizeof(left.bytes)) == 0;
@@ -32,24 +32,174 @@
 #ifndef MXFPP_MXF_TYPES_H_
 #define MXFPP_MXF_TYPES_H_
 
+#include <cstring>
+#include <functional>
+
 #include <mxf/mxf_types.h>
 
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+
+
+namespace mxfpp
+{
+
+// 16 and 32 byte identifiers are compared and hashed using 64-bit loads
+
+inline uint64_t load_native_uint64(const void *bytes)
+{
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64_t load_be_uint64(const void *bytes)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return __builtin_bswap64(load_native_uint64(bytes));
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return load_native_uint64(bytes);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(load_native_uint64(bytes));
+#else
+    const unsigned char *b = static_cast<const unsigned char*>(bytes);
+    return ((uint64_t)b[0] << 56) | ((uint64_t)b[1] << 48) | ((uint64_t)b[2] << 40) | ((uint64_t)b[3] << 32) |
+           ((uint64_t)b[4] << 24) | ((uint64_t)b[5] << 16) | ((uint64_t)b[6] << 8)  |  (uint64_t)b[7];
+#endif
+}
+
+inline void store_be_uint64(void *bytes, uint64_t value)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+    memcpy(bytes, &value, sizeof(value));
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(bytes, &value, sizeof(value));
+#elif defined(_MSC_VER)
+    value = _byteswap_uint64(value);
+    memcpy(bytes, &value, sizeof(value));
+#else
+    unsigned char *b = static_cast<unsigned char*>(bytes);
+    int i;
+    for (i = 7; i >= 0; i--) {
+        b[i] = (unsigned char)(value & 0xff);
+        value >>= 8;
+    }
+#endif
+}
+
+inline void store_be_uint32(void *bytes, uint32_t value)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap32(value);
+    memcpy(bytes, &value, sizeof(value));
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    memcpy(bytes, &value, sizeof(value));
+#elif defined(_MSC_VER)
+    value = _byteswap_ulong(value);
+    memcpy(bytes, &value, sizeof(value));
+#else
+    unsigned char *b = static_cast<unsigned char*>(bytes);
+    b[0] = (unsigned char)((value >> 24) & 0xff);
+    b[1] = (unsigned char)((value >> 16) & 0xff);
+    b[2] = (unsigned char)((value >> 8) & 0xff);
+    b[3] = (unsigned char)( value        & 0xff);
+#endif
+}
+
+// numWords is the identifier size in 64-bit words
+inline bool equals_id(const void *left, const void *right, int numWords)
+{
+    const unsigned char *l = static_cast<const unsigned char*>(left);
+    const unsigned char *r = static_cast<const unsigned char*>(right);
+    uint64_t diff = 0;
+    int i;
+    for (i = 0; i < numWords; i++)
+        diff |= load_native_uint64(&l[i * 8]) ^ load_native_uint64(&r[i * 8]);
+    return diff == 0;
+}
+
+// the same order as memcmp
+inline int compare_id(const void *left, const void *right, int numWords)
+{
+    const unsigned char *l = static_cast<const unsigned char*>(left);
+    const unsigned char *r = static_cast<const unsigned char*>(right);
+    int i;
+    for (i = 0; i < numWords; i++) {
+        uint64_t lw = load_be_uint64(&l[i * 8]);
+        uint64_t rw = load_be_uint64(&r[i * 8]);
+        if (lw != rw)
+            return (lw < rw ? -1 : 1);
+    }
+    return 0;
+}
+
+inline size_t hash_id(const void *bytes, int numWords)
+{
+    const unsigned char *b = static_cast<const unsigned char*>(bytes);
+    uint64_t hash = 0;
+    int i;
+    for (i = 0; i < numWords; i++) {
+        hash ^= load_native_uint64(&b[i * 8]);
+        hash *= 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 32;
+    }
+    return (size_t)hash;
+}
 
+};
 
-bool operator == (const mxfKey &left, const mxfKey &right);
-bool operator != (const mxfKey &left, const mxfKey &right);
-bool operator <  (const mxfKey &left, const mxfKey &right);
 
-bool operator == (const mxfUUID &left, const mxfUUID &right);
-bool operator != (const mxfUUID &left, const mxfUUID &right);
-bool operator <  (const mxfUUID &left, const mxfUUID &right);
+
+inline bool operator == (const mxfKey &left, const mxfKey &right)
+{
+    return mxfpp::equals_id(&left, &right, 2);
+}
+
+inline bool operator != (const mxfKey &left, const mxfKey &right)
+{
+    return !mxfpp::equals_id(&left, &right, 2);
+}
+
+inline bool operator < (const mxfKey &left, const mxfKey &right)
+{
+    return mxfpp::compare_id(&left, &right, 2) < 0;
+}
+
+inline bool operator == (const mxfUUID &left, const mxfUUID &right)
+{
+    return mxfpp::equals_id(&left, &right, 2);
+}
+
+inline bool operator != (const mxfUUID &left, const mxfUUID &right)
+{
+    return !mxfpp::equals_id(&left, &right, 2);
+}
+
+inline bool operator < (const mxfUUID &left, const mxfUUID &right)
+{
+    return mxfpp::compare_id(&left, &right, 2) < 0;
+}
 
 bool operator == (const mxfRational &left, const mxfRational &right);
 bool operator != (const mxfRational &left, const mxfRational &right);
 
-bool operator == (const mxfUMID &left, const mxfUMID &right);
-bool operator != (const mxfUMID &left, const mxfUMID &right);
-bool operator <  (const mxfUMID &left, const mxfUMID &right);
+inline bool operator == (const mxfUMID &left, const mxfUMID &right)
+{
+    return mxfpp::equals_id(&left, &right, 4);
+}
+
+inline bool operator != (const mxfUMID &left, const mxfUMID &right)
+{
+    return !mxfpp::equals_id(&left, &right, 4);
+}
+
+inline bool operator < (const mxfUMID &left, const mxfUMID &right)
+{
+    return mxfpp::compare_id(&left, &right, 4) < 0;
+}
 
 bool operator == (const mxfExtendedUMID &left, const mxfExtendedUMID &right);
 bool operator != (const mxfExtendedUMID &left, const mxfExtendedUMID &right);
@@ -57,5 +207,30 @@ bool operator <  (const mxfExtendedUMID &left, const mxfExtendedUMID &right);
 
 
 
+namespace std
+{
+
+template <>
+struct hash<mxfKey>
+{
+    size_t operator()(const mxfKey &key) const { return mxfpp::hash_id(&key, 2); }
+};
+
+template <>
+struct hash<mxfUUID>
+{
+    size_t operator()(const mxfUUID &uuid) const { return mxfpp::hash_id(&uuid, 2); }
+};
+
+template <>
+struct hash<mxfUMID>
+{
+    size_t operator()(const mxfUMID &umid) const { return mxfpp::hash_id(&umid, 4); }
+};
+
+};
+
+
+
 #endif
 
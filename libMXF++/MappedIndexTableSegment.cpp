@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#define MAPPED_INDEX_USE_MMAP   1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <memory>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+
+static uint16_t get_be_uint16(const uint8_t *bytes)
+{
+    return (uint16_t)((bytes[0] << 8) | bytes[1]);
+}
+
+static uint32_t get_be_uint32(const uint8_t *bytes)
+{
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+}
+
+
+
+MappedIndexTableSegment* MappedIndexTableSegment::open(const string &filename, int64_t position,
+                                                       uint64_t segmentLen)
+{
+    auto_ptr<MappedIndexTableSegment> segment(new MappedIndexTableSegment());
+
+#ifdef MAPPED_INDEX_USE_MMAP
+    // accessing mapped pages beyond the end of a truncated file raises SIGBUS and so the buffered read is
+    // used to report an error for a segment that extends beyond the end of the file
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (fd >= 0 && (fstat(fd, &file_stat) != 0 || position < 0 ||
+                    (uint64_t)position + segmentLen > (uint64_t)file_stat.st_size)) {
+        ::close(fd);
+        fd = -1;
+    }
+    if (fd >= 0) {
+        long page_size = sysconf(_SC_PAGESIZE);
+        int64_t map_position = position - position % (page_size > 0 ? page_size : 4096);
+        size_t map_size = (size_t)(segmentLen + (position - map_position));
+        void *address = mmap(0, map_size, PROT_READ, MAP_PRIVATE, fd, (off_t)map_position);
+        ::close(fd);
+        if (address != MAP_FAILED) {
+            segment->_mapAddress = address;
+            segment->_mapSize = map_size;
+            segment->parse((const uint8_t*)address + (position - map_position), segmentLen);
+            return segment.release();
+        }
+    }
+#endif
+
+    // fall back to reading the segment into a buffer
+    auto_ptr<File> file(File::openRead(filename));
+    file->seek(position, SEEK_SET);
+    return read(file.get(), segmentLen);
+}
+
+MappedIndexTableSegment* MappedIndexTableSegment::read(File *mxfFile, uint64_t segmentLen)
+{
+    MXFPP_CHECK(segmentLen <= UINT32_MAX);
+
+    auto_ptr<MappedIndexTableSegment> segment(new MappedIndexTableSegment());
+    segment->_buffer.resize((size_t)segmentLen);
+    if (segmentLen > 0)
+        MXFPP_CHECK(mxfFile->read(&segment->_buffer[0], (uint32_t)segmentLen) == segmentLen);
+    segment->parse(segment->_buffer.empty() ? 0 : &segment->_buffer[0], segmentLen);
+
+    return segment.release();
+}
+
+MappedIndexTableSegment::MappedIndexTableSegment()
+{
+    _mapAddress = 0;
+    _mapSize = 0;
+    memset(&_instanceUID, 0, sizeof(_instanceUID));
+    _indexEditRate.numerator = 0;
+    _indexEditRate.denominator = 0;
+    _indexStartPosition = 0;
+    _indexDuration = 0;
+    _editUnitByteCount = 0;
+    _indexSID = 0;
+    _bodySID = 0;
+    _sliceCount = 0;
+    _posTableCount = 0;
+    _deltaEntries = 0;
+    _numDeltaEntries = 0;
+    _deltaEntrySize = 0;
+    _indexEntries = 0;
+    _numIndexEntries = 0;
+    _indexEntrySize = 0;
+}
+
+MappedIndexTableSegment::~MappedIndexTableSegment()
+{
+#ifdef MAPPED_INDEX_USE_MMAP
+    if (_mapAddress)
+        munmap(_mapAddress, _mapSize);
+#endif
+}
+
+void MappedIndexTableSegment::getDeltaEntry(uint32_t index, int8_t *posTableIndex, uint8_t *slice,
+                                            uint32_t *elementData) const
+{
+    MXFPP_CHECK(index < _numDeltaEntries);
+
+    const uint8_t *bytes = _deltaEntries + (size_t)index * _deltaEntrySize;
+    *posTableIndex = (int8_t)bytes[0];
+    *slice = bytes[1];
+    *elementData = get_be_uint32(&bytes[2]);
+}
+
+void MappedIndexTableSegment::getIndexEntry(uint32_t index, int8_t *temporalOffset, int8_t *keyFrameOffset,
+                                            uint8_t *flags, uint64_t *streamOffset) const
+{
+    const uint8_t *bytes = getIndexEntryBytes(index);
+    *temporalOffset = (int8_t)bytes[0];
+    *keyFrameOffset = (int8_t)bytes[1];
+    *flags = bytes[2];
+    *streamOffset = load_be_uint64(&bytes[3]);
+}
+
+uint64_t MappedIndexTableSegment::getStreamOffset(uint32_t index) const
+{
+    return load_be_uint64(getIndexEntryBytes(index) + 3);
+}
+
+uint32_t MappedIndexTableSegment::getSliceOffset(uint32_t index, uint8_t slice) const
+{
+    MXFPP_CHECK(slice < _sliceCount);
+    return get_be_uint32(getIndexEntryBytes(index) + 11 + 4 * slice);
+}
+
+mxfRational MappedIndexTableSegment::getPosTableEntry(uint32_t index, uint8_t posTableIndex) const
+{
+    MXFPP_CHECK(posTableIndex < _posTableCount);
+
+    const uint8_t *bytes = getIndexEntryBytes(index) + 11 + 4 * _sliceCount + 8 * posTableIndex;
+    mxfRational value;
+    value.numerator = (int32_t)get_be_uint32(bytes);
+    value.denominator = (int32_t)get_be_uint32(bytes + 4);
+    return value;
+}
+
+void MappedIndexTableSegment::parse(const uint8_t *data, uint64_t size)
+{
+    uint64_t offset = 0;
+    while (offset + 4 <= size) {
+        uint16_t tag = get_be_uint16(&data[offset]);
+        uint16_t len = get_be_uint16(&data[offset + 2]);
+        const uint8_t *value = &data[offset + 4];
+        uint64_t value_size = size - offset - 4;
+        offset += 4;
+
+        if (tag == 0x3f09 || tag == 0x3f0a) {
+            // the array size is taken from the array header because the local length overflows for large arrays
+            if (value_size < 8)
+                throw MXFException("Invalid index table segment array");
+            uint32_t count = get_be_uint32(value);
+            uint32_t element_len = get_be_uint32(value + 4);
+            uint64_t array_size = 8 + (uint64_t)count * element_len;
+            if (array_size > value_size)
+                throw MXFException("Index table segment array exceeds segment length");
+
+            if (tag == 0x3f09) {
+                if (count > 0 && element_len < 6)
+                    throw MXFException("Invalid delta entry length %u", element_len);
+                _deltaEntries = value + 8;
+                _numDeltaEntries = count;
+                _deltaEntrySize = element_len;
+            } else {
+                _indexEntries = value + 8;
+                _numIndexEntries = count;
+                _indexEntrySize = element_len;
+            }
+            offset += array_size;
+            continue;
+        }
+
+        if (len > value_size)
+            throw MXFException("Index table segment item 0x%04x exceeds segment length", tag);
+
+        switch (tag)
+        {
+            case 0x3c0a:
+                if (len == sizeof(_instanceUID))
+                    memcpy(&_instanceUID, value, sizeof(_instanceUID));
+                break;
+            case 0x3f0b:
+                if (len == 8) {
+                    _indexEditRate.numerator = (int32_t)get_be_uint32(value);
+                    _indexEditRate.denominator = (int32_t)get_be_uint32(value + 4);
+                }
+                break;
+            case 0x3f0c:
+                if (len == 8)
+                    _indexStartPosition = (int64_t)load_be_uint64(value);
+                break;
+            case 0x3f0d:
+                if (len == 8)
+                    _indexDuration = (int64_t)load_be_uint64(value);
+                break;
+            case 0x3f05:
+                if (len == 4)
+                    _editUnitByteCount = get_be_uint32(value);
+                break;
+            case 0x3f06:
+                if (len == 4)
+                    _indexSID = get_be_uint32(value);
+                break;
+            case 0x3f07:
+                if (len == 4)
+                    _bodySID = get_be_uint32(value);
+                break;
+            case 0x3f08:
+                if (len == 1)
+                    _sliceCount = value[0];
+                break;
+            case 0x3f0e:
+                if (len == 1)
+                    _posTableCount = value[0];
+                break;
+            default:
+                break;
+        }
+
+        offset += len;
+    }
+
+    if (_numIndexEntries > 0 && _indexEntrySize < 11 + 4 * (uint32_t)_sliceCount + 8 * (uint32_t)_posTableCount)
+        throw MXFException("Invalid index entry length %u", _indexEntrySize);
+}
+
+const uint8_t* MappedIndexTableSegment::getIndexEntryBytes(uint32_t index) const
+{
+    MXFPP_CHECK(index < _numIndexEntries);
+    return _indexEntries + (size_t)index * _indexEntrySize;
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_MAPPED_INDEX_TABLE_SEGMENT_H_
+#define MXFPP_MAPPED_INDEX_TABLE_SEGMENT_H_
+
+#include <string>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+class File;
+
+// provides random access to the entries of an index table segment by decoding the big-endian fields on
+// demand, without creating the libMXF entry lists. The segment value is memory mapped where mmap is
+// available and otherwise read into a single buffer
+class MappedIndexTableSegment
+{
+public:
+    // position is the file position of the segment value, i.e. following the key and length
+    static MappedIndexTableSegment* open(const std::string &filename, int64_t position, uint64_t segmentLen);
+    // reads the segment value from the current file position
+    static MappedIndexTableSegment* read(File *mxfFile, uint64_t segmentLen);
+
+public:
+    ~MappedIndexTableSegment();
+
+    bool isMapped() const { return _mapAddress != 0; }
+
+    mxfUUID getInstanceUID() const { return _instanceUID; }
+    mxfRational getIndexEditRate() const { return _indexEditRate; }
+    int64_t getIndexStartPosition() const { return _indexStartPosition; }
+    int64_t getIndexDuration() const { return _indexDuration; }
+    uint32_t getEditUnitByteCount() const { return _editUnitByteCount; }
+    uint32_t getIndexSID() const { return _indexSID; }
+    uint32_t getBodySID() const { return _bodySID; }
+    uint8_t getSliceCount() const { return _sliceCount; }
+    uint8_t getPosTableCount() const { return _posTableCount; }
+
+    uint32_t getNumDeltaEntries() const { return _numDeltaEntries; }
+    void getDeltaEntry(uint32_t index, int8_t *posTableIndex, uint8_t *slice, uint32_t *elementData) const;
+
+    uint32_t getNumIndexEntries() const { return _numIndexEntries; }
+    void getIndexEntry(uint32_t index, int8_t *temporalOffset, int8_t *keyFrameOffset, uint8_t *flags,
+                       uint64_t *streamOffset) const;
+    uint64_t getStreamOffset(uint32_t index) const;
+    uint32_t getSliceOffset(uint32_t index, uint8_t slice) const;
+    mxfRational getPosTableEntry(uint32_t index, uint8_t posTableIndex) const;
+
+private:
+    MappedIndexTableSegment();
+
+    void parse(const uint8_t *data, uint64_t size);
+    const uint8_t* getIndexEntryBytes(uint32_t index) const;
+
+private:
+    void *_mapAddress;
+    size_t _mapSize;
+    std::vector<uint8_t> _buffer;
+
+    mxfUUID _instanceUID;
+    mxfRational _indexEditRate;
+    int64_t _indexStartPosition;
+    int64_t _indexDuration;
+    uint32_t _editUnitByteCount;
+    uint32_t _indexSID;
+    uint32_t _bodySID;
+    uint8_t _sliceCount;
+    uint8_t _posTableCount;
+
+    const uint8_t *_deltaEntries;
+    uint32_t _numDeltaEntries;
+    uint32_t _deltaEntrySize;
+    const uint8_t *_indexEntries;
+    uint32_t _numIndexEntries;
+    uint32_t _indexEntrySize;
+};
+
+
+};
+
+
+
+#endif
+
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdlib>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+// all allocations are aligned to this size
+#define ARENA_ALIGNMENT     16
+
+
+static AllocationHook g_allocationHook = 0;
+static void *g_allocationHookContext = 0;
+
+
+
+void mxfpp::set_allocation_hook(AllocationHook hook, void *context)
+{
+    g_allocationHook = hook;
+    g_allocationHookContext = context;
+}
+
+void mxfpp::call_allocation_hook(size_t size, bool allocate)
+{
+#ifdef MXFPP_ENABLE_ALLOCATION_HOOK
+    if (g_allocationHook)
+        g_allocationHook(g_allocationHookContext, size, allocate);
+#else
+    (void)size;
+    (void)allocate;
+#endif
+}
+
+
+
+MemoryArena::MemoryArena(size_t blockSize)
+{
+    _blockSize = blockSize;
+    _blockPtr = 0;
+    _blockAvailable = 0;
+    _allocatedSize = 0;
+    _reservedSize = 0;
+}
+
+MemoryArena::~MemoryArena()
+{
+    size_t i;
+    for (i = 0; i < _blocks.size(); i++)
+    {
+        free(_blocks[i]);
+    }
+    if (_reservedSize > 0)
+    {
+        call_allocation_hook(_reservedSize, false);
+    }
+}
+
+void* MemoryArena::allocate(size_t size)
+{
+    size_t alignedSize = (size + ARENA_ALIGNMENT - 1) & ~((size_t)ARENA_ALIGNMENT - 1);
+    if (alignedSize == 0)
+    {
+        alignedSize = ARENA_ALIGNMENT;
+    }
+
+    if (alignedSize > _blockAvailable)
+    {
+        // large allocations get a block of their own so that the remainder of the current block is not wasted
+        if (alignedSize > _blockSize / 4)
+        {
+            unsigned char *block = (unsigned char*)malloc(alignedSize);
+            if (!block)
+            {
+                throw bad_alloc();
+            }
+            _blocks.push_back(block);
+            _reservedSize += alignedSize;
+            _allocatedSize += alignedSize;
+            call_allocation_hook(alignedSize, true);
+            return block;
+        }
+
+        unsigned char *block = (unsigned char*)malloc(_blockSize);
+        if (!block)
+        {
+            throw bad_alloc();
+        }
+        _blocks.push_back(block);
+        _reservedSize += _blockSize;
+        call_allocation_hook(_blockSize, true);
+        _blockPtr = block;
+        _blockAvailable = _blockSize;
+    }
+
+    void *result = _blockPtr;
+    _blockPtr += alignedSize;
+    _blockAvailable -= alignedSize;
+    _allocatedSize += alignedSize;
+
+    return result;
+}
+
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_MEMORY_ARENA_H_
+#define MXFPP_MEMORY_ARENA_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+// The hook is called for the metadata set wrapper and arena block allocations and releases if the library is
+// compiled with MXFPP_ENABLE_ALLOCATION_HOOK defined. An arena reports the release of all its blocks in one call
+typedef void (*AllocationHook)(void *context, size_t size, bool allocate);
+
+void set_allocation_hook(AllocationHook hook, void *context);
+void call_allocation_hook(size_t size, bool allocate);
+
+
+// A monotonic allocator: memory is taken from large blocks and is only released when the arena is destroyed
+
+class MemoryArena
+{
+public:
+    MemoryArena(size_t blockSize = 64 * 1024);
+    ~MemoryArena();
+
+    void* allocate(size_t size);
+
+    size_t getAllocatedSize() const { return _allocatedSize; }
+    size_t getReservedSize() const { return _reservedSize; }
+    size_t getBlockCount() const { return _blocks.size(); }
+
+private:
+    MemoryArena(const MemoryArena &arena);
+    MemoryArena& operator=(const MemoryArena &arena);
+
+    size_t _blockSize;
+    std::vector<unsigned char*> _blocks;
+    unsigned char *_blockPtr;
+    size_t _blockAvailable;
+    size_t _allocatedSize;
+    size_t _reservedSize;
+};
+
+
+// A standard library allocator that takes memory from a MemoryArena if one is set, or else from the heap.
+// Memory taken from the arena is not returned in deallocate()
+
+template <class T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template <class U>
+    struct rebind
+    {
+        typedef ArenaAllocator<U> other;
+    };
+
+public:
+    ArenaAllocator() : _arena(0) {}
+    explicit ArenaAllocator(MemoryArena *arena) : _arena(arena) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : _arena(other.getArena()) {}
+
+    T* allocate(size_t n)
+    {
+        if (_arena)
+            return static_cast<T*>(_arena->allocate(n * sizeof(T)));
+        else
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t n)
+    {
+        (void)n;
+        if (!_arena)
+            ::operator delete(ptr);
+    }
+
+    MemoryArena* getArena() const { return _arena; }
+
+private:
+    MemoryArena *_arena;
+};
+
+template <class T, class U>
+bool operator==(const ArenaAllocator<T> &left, const ArenaAllocator<U> &right)
+{
+    return left.getArena() == right.getArena();
+}
+
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T> &left, const ArenaAllocator<U> &right)
+{
+    return left.getArena() != right.getArena();
+}
+
+
+};
+
+
+
+#endif
+
@@ -112,13 +112,163 @@ private:
 };
 
 
+// transcode a big-endian UTF-16 item value to UTF-8, stopping at a null character
+// the output is null terminated and truncated at a character boundary if it doesn't fit in outSize
+// returns the full UTF-8 length excluding the terminator, or (size_t)(-1) if the value is invalid UTF-16
+static size_t utf16be_to_utf8(const uint8_t *value, uint32_t valueLen, char *out, size_t outSize)
+{
+    size_t utf8Len = 0;
+    bool truncated = (outSize == 0);
+    uint32_t i = 0;
+    while (i + 1 < valueLen)
+    {
+        uint32_t c = (value[i] << 8) | value[i + 1];
+        i += 2;
+        if (c == 0)
+            break;
+
+        if (c >= 0xd800 && c <= 0xdbff)
+        {
+            if (i + 1 >= valueLen)
+                return (size_t)(-1);
+            uint32_t c2 = (value[i] << 8) | value[i + 1];
+            if (c2 < 0xdc00 || c2 > 0xdfff)
+                return (size_t)(-1);
+            i += 2;
+            c = 0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00);
+        }
+        else if (c >= 0xdc00 && c <= 0xdfff)
+        {
+            return (size_t)(-1);
+        }
+
+        char bytes[4];
+        size_t numBytes;
+        if (c < 0x80)
+        {
+            bytes[0] = (char)c;
+            numBytes = 1;
+        }
+        else if (c < 0x800)
+        {
+            bytes[0] = (char)(0xc0 | (c >> 6));
+            bytes[1] = (char)(0x80 | (c & 0x3f));
+            numBytes = 2;
+        }
+        else if (c < 0x10000)
+        {
+            bytes[0] = (char)(0xe0 | (c >> 12));
+            bytes[1] = (char)(0x80 | ((c >> 6) & 0x3f));
+            bytes[2] = (char)(0x80 | (c & 0x3f));
+            numBytes = 3;
+        }
+        else
+        {
+            bytes[0] = (char)(0xf0 | (c >> 18));
+            bytes[1] = (char)(0x80 | ((c >> 12) & 0x3f));
+            bytes[2] = (char)(0x80 | ((c >> 6) & 0x3f));
+            bytes[3] = (char)(0x80 | (c & 0x3f));
+            numBytes = 4;
+        }
+
+        if (!truncated && utf8Len + numBytes < outSize)
+        {
+            size_t j;
+            for (j = 0; j < numBytes; j++)
+                out[utf8Len + j] = bytes[j];
+        }
+        else if (!truncated)
+        {
+            out[utf8Len] = '\0';
+            truncated = true;
+        }
+        utf8Len += numBytes;
+    }
+
+    if (!truncated)
+        out[utf8Len] = '\0';
+
+    return utf8Len;
+}
+
+
+
+// wrapper allocations are prefixed with the arena they were taken from, which is null for the heap,
+// and the allocation size
+#define ALLOC_PREFIX_SIZE   16
+
+typedef struct
+{
+    MemoryArena *arena;
+    uint32_t size;
+} AllocPrefix;
+
+void* MetadataSet::operator new(size_t size)
+{
+    unsigned char *ptr = (unsigned char*)::operator new(size + ALLOC_PREFIX_SIZE);
+    ((AllocPrefix*)ptr)->arena = 0;
+    ((AllocPrefix*)ptr)->size = (uint32_t)(size + ALLOC_PREFIX_SIZE);
+    call_allocation_hook(size + ALLOC_PREFIX_SIZE, true);
+    return ptr + ALLOC_PREFIX_SIZE;
+}
+
+void* MetadataSet::operator new(size_t size, MemoryArena *arena)
+{
+    if (!arena)
+        return MetadataSet::operator new(size);
+
+    unsigned char *ptr = (unsigned char*)arena->allocate(size + ALLOC_PREFIX_SIZE);
+    ((AllocPrefix*)ptr)->arena = arena;
+    ((AllocPrefix*)ptr)->size = (uint32_t)(size + ALLOC_PREFIX_SIZE);
+    return ptr + ALLOC_PREFIX_SIZE;
+}
+
+void MetadataSet::operator delete(void *ptr)
+{
+    if (!ptr)
+        return;
+
+    // arena memory is released when the arena is destroyed
+    unsigned char *allocPtr = (unsigned char*)ptr - ALLOC_PREFIX_SIZE;
+    if (((AllocPrefix*)allocPtr)->arena == 0)
+    {
+        call_allocation_hook(((AllocPrefix*)allocPtr)->size, false);
+        ::operator delete(allocPtr);
+    }
+}
+
+size_t MetadataSet::getAllocationSize() const
+{
+    const unsigned char *allocPtr = (const unsigned char*)this - ALLOC_PREFIX_SIZE;
+    return ((const AllocPrefix*)allocPtr)->size;
+}
+
+size_t MetadataSet::getCacheSize() const
+{
+    size_t size = _encodedBytes.capacity();
+    size_t i;
+    for (i = 0; i < _refArrayCaches.size(); i++)
+        size += sizeof(RefArrayCache) + _refArrayCaches[i].sets.capacity() * sizeof(MetadataSet*);
+    return size;
+}
+
+void MetadataSet::operator delete(void *ptr, MemoryArena *arena)
+{
+    (void)arena;
+    MetadataSet::operator delete(ptr);
+}
+
 
 MetadataSet::MetadataSet(const MetadataSet &set)
-: _headerMetadata(set._headerMetadata), _cMetadataSet(set._cMetadataSet)
+: _headerMetadata(set._headerMetadata), _cMetadataSet(set._cMetadataSet), _setKind(set._setKind),
+  _setKindMask(set._setKindMask), _modificationCount(0),
+  _encodedModificationCount(0), _encodedLLen(0)
 {}
 
 MetadataSet::MetadataSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet)
-: _headerMetadata(headerMetadata), _cMetadataSet(metadataSet)
+: _headerMetadata(headerMetadata), _cMetadataSet(metadataSet), _setKind(UNKNOWN_SET_KIND),
+  _setKindMask(0), _modificationCount(0),
+  _encodedModificationCount(0), _encodedLLen(0)
 {}
 
 MetadataSet::~MetadataSet()
@@ -145,6 +295,41 @@ vector<MXFMetadataItem*> MetadataSet::getItems() const
     return items;
 }
 
+void MetadataSet::markModified()
+{
+    _modificationCount++;
+    if (_headerMetadata)
+        _headerMetadata->markModified();
+}
+
+MXFMetadataItem* MetadataSet::findItem(const mxfKey *itemKey, mxfLocalTag localTagHint) const
+{
+    ::MXFListIterator iter;
+    MXFMetadataItem *item;
+
+    if (localTagHint != 0)
+    {
+        mxf_initialise_list_iter(&iter, &_cMetadataSet->items);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            item = (MXFMetadataItem*)mxf_get_iter_element(&iter);
+            if (item->tag == localTagHint && mxf_equals_key(&item->key, itemKey))
+                return item;
+        }
+    }
+
+    // the item could have a different local tag in a file
+    mxf_initialise_list_iter(&iter, &_cMetadataSet->items);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        item = (MXFMetadataItem*)mxf_get_iter_element(&iter);
+        if (mxf_equals_key(&item->key, itemKey))
+            return item;
+    }
+
+    return 0;
+}
+
 bool MetadataSet::haveItem(const mxfKey *itemKey) const
 {
     return mxf_have_item(_cMetadataSet, itemKey) != 0;
@@ -321,33 +506,31 @@ mxfRGBALayout MetadataSet::getRGBALayoutItem(const mxfKey *itemKey) const
 string MetadataSet::getStringItem(const mxfKey *itemKey) const
 {
     string result;
-    mxfUTF16Char *utf16Result = 0;
-    char *utf8Result = 0;
-    try
-    {
-        uint16_t utf16Size;
-        MXFPP_CHECK(mxf_get_utf16string_item_size(_cMetadataSet, itemKey, &utf16Size));
-        utf16Result = new mxfUTF16Char[utf16Size];
-        MXFPP_CHECK(mxf_get_utf16string_item(_cMetadataSet, itemKey, utf16Result));
+    getStringItem(itemKey, &result);
+    return result;
+}
 
-        size_t utf8Size = mxf_utf16_to_utf8(0, utf16Result, 0);
-        MXFPP_CHECK(utf8Size != (size_t)(-1));
-        utf8Size += 1;
-        utf8Result = new char[utf8Size];
-        mxf_utf16_to_utf8(utf8Result, utf16Result, utf8Size);
-        result = utf8Result;
-        delete [] utf16Result;
-        utf16Result = 0;
-        delete [] utf8Result;
-        utf8Result = 0;
-        return result;
-    }
-    catch (...)
-    {
-        delete [] utf16Result;
-        delete [] utf8Result;
-        throw;
-    }
+size_t MetadataSet::getStringItem(const mxfKey *itemKey, char *buffer, size_t bufferSize) const
+{
+    MXFMetadataItem *item;
+    MXFPP_CHECK(mxf_get_item(_cMetadataSet, itemKey, &item));
+
+    size_t utf8Size = utf16be_to_utf8(item->value, item->length, buffer, bufferSize);
+    MXFPP_CHECK(utf8Size != (size_t)(-1));
+    return utf8Size;
+}
+
+void MetadataSet::getStringItem(const mxfKey *itemKey, string *value) const
+{
+    MXFMetadataItem *item;
+    MXFPP_CHECK(mxf_get_item(_cMetadataSet, itemKey, &item));
+
+    // each UTF-16 code unit is at most 3 UTF-8 bytes
+    size_t maxUTF8Size = (item->length / 2) * 3;
+    value->resize(maxUTF8Size + 1);
+    size_t utf8Size = utf16be_to_utf8(item->value, item->length, &(*value)[0], value->size());
+    MXFPP_CHECK(utf8Size != (size_t)(-1));
+    value->resize(utf8Size);
 }
 
 string MetadataSet::getUTF8StringItem(const mxfKey *itemKey) const
@@ -440,6 +623,108 @@ MetadataSet* MetadataSet::getWeakRefItemLight(const mxfKey *itemKey) const
     return _headerMetadata->wrap(cSet);
 }
 
+const uint8_t* MetadataSet::getArrayItemElements(const mxfKey *itemKey, uint32_t elementLength,
+                                                 uint32_t *size) const
+{
+    MXFMetadataItem *item;
+    MXFPP_CHECK(mxf_get_item(_cMetadataSet, itemKey, &item));
+    MXFPP_CHECK(item->length >= 8);
+
+    uint32_t arrayLen;
+    uint32_t arrayElementLen;
+    mxf_get_uint32(item->value, &arrayLen);
+    mxf_get_uint32(&item->value[4], &arrayElementLen);
+    MXFPP_CHECK(arrayLen == 0 || arrayElementLen == elementLength);
+    MXFPP_CHECK((uint64_t)arrayLen * elementLength <= (uint64_t)(item->length - 8));
+
+    *size = arrayLen;
+    return &item->value[8];
+}
+
+ArrayItemView<uint8_t> MetadataSet::getUInt8ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 1, &size);
+    return ArrayItemView<uint8_t>(elements, size, 1, mxf_get_uint8);
+}
+
+ArrayItemView<uint16_t> MetadataSet::getUInt16ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 2, &size);
+    return ArrayItemView<uint16_t>(elements, size, 2, mxf_get_uint16);
+}
+
+ArrayItemView<uint32_t> MetadataSet::getUInt32ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 4, &size);
+    return ArrayItemView<uint32_t>(elements, size, 4, mxf_get_uint32);
+}
+
+ArrayItemView<uint64_t> MetadataSet::getUInt64ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 8, &size);
+    return ArrayItemView<uint64_t>(elements, size, 8, mxf_get_uint64);
+}
+
+ArrayItemView<int8_t> MetadataSet::getInt8ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 1, &size);
+    return ArrayItemView<int8_t>(elements, size, 1, mxf_get_int8);
+}
+
+ArrayItemView<int16_t> MetadataSet::getInt16ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 2, &size);
+    return ArrayItemView<int16_t>(elements, size, 2, mxf_get_int16);
+}
+
+ArrayItemView<int32_t> MetadataSet::getInt32ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 4, &size);
+    return ArrayItemView<int32_t>(elements, size, 4, mxf_get_int32);
+}
+
+ArrayItemView<int64_t> MetadataSet::getInt64ArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 8, &size);
+    return ArrayItemView<int64_t>(elements, size, 8, mxf_get_int64);
+}
+
+ArrayItemView<mxfUUID> MetadataSet::getUUIDArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, mxfUUID_extlen, &size);
+    return ArrayItemView<mxfUUID>(elements, size, mxfUUID_extlen, mxf_get_uuid);
+}
+
+ArrayItemView<mxfUL> MetadataSet::getULArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, mxfUL_extlen, &size);
+    return ArrayItemView<mxfUL>(elements, size, mxfUL_extlen, mxf_get_ul);
+}
+
+ArrayItemView<mxfUMID> MetadataSet::getUMIDArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, mxfUMID_extlen, &size);
+    return ArrayItemView<mxfUMID>(elements, size, mxfUMID_extlen, mxf_get_umid);
+}
+
+ArrayItemView<mxfRational> MetadataSet::getRationalArrayItemView(const mxfKey *itemKey) const
+{
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, 8, &size);
+    return ArrayItemView<mxfRational>(elements, size, 8, mxf_get_rational);
+}
+
 vector<uint8_t> MetadataSet::getUInt8ArrayItem(const mxfKey *itemKey) const
 {
     vector<uint8_t> result;
@@ -810,119 +1095,184 @@ ObjectIterator* MetadataSet::getWeakRefArrayItem(const mxfKey *itemKey) const
     return new ReferencedObjectIterator(_headerMetadata, this, itemKey);
 }
 
+const vector<MetadataSet*>& MetadataSet::dereferenceRefArrayItem(const mxfKey *itemKey) const
+{
+    MXFPP_CHECK(_headerMetadata != 0);
+
+    RefArrayCache *cache = 0;
+    size_t i;
+    for (i = 0; i < _refArrayCaches.size(); i++)
+    {
+        if (mxf_equals_key(&_refArrayCaches[i].itemKey, itemKey))
+        {
+            cache = &_refArrayCaches[i];
+            if (_headerMetadata->isFrozen() ||
+                (cache->modificationCount == _modificationCount &&
+                    cache->wrapperGeneration == _headerMetadata->_wrapperGeneration))
+            {
+                return cache->sets;
+            }
+            break;
+        }
+    }
+    if (!cache)
+    {
+        // the caches for all reference array items present were created when the header metadata was frozen
+        if (_headerMetadata->isFrozen())
+            throw MXFException("Reference array item was not resolved when the header metadata was frozen");
+
+        _refArrayCaches.push_back(RefArrayCache());
+        cache = &_refArrayCaches.back();
+        cache->itemKey = *itemKey;
+    }
+
+    uint32_t size;
+    const uint8_t *elements = getArrayItemElements(itemKey, mxfUUID_extlen, &size);
+    bool complete = _headerMetadata->wrapReferencedSets(elements, size, itemKey, &cache->sets);
+
+    // a reference that could not be resolved may resolve once the set is added, so don't cache the result
+    cache->modificationCount = (complete ? _modificationCount : _modificationCount - 1);
+    cache->wrapperGeneration = _headerMetadata->_wrapperGeneration;
+
+    return cache->sets;
+}
+
 
 void MetadataSet::setRawBytesItem(const mxfKey *itemKey, ByteArray value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_item(_cMetadataSet, itemKey, value.data, value.length));
 }
 
 void MetadataSet::setUInt8Item(const mxfKey *itemKey, uint8_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_uint8_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setUInt16Item(const mxfKey *itemKey, uint16_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_uint16_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setUInt32Item(const mxfKey *itemKey, uint32_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_uint32_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setUInt64Item(const mxfKey *itemKey, uint64_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_uint64_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setInt8Item(const mxfKey *itemKey, int8_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_int8_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setInt16Item(const mxfKey *itemKey, int16_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_int16_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setInt32Item(const mxfKey *itemKey, int32_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_int32_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setInt64Item(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_int64_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setFloatItem(const mxfKey *itemKey, float value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_float_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setVersionTypeItem(const mxfKey *itemKey, mxfVersionType value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_version_type_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setUUIDItem(const mxfKey *itemKey, mxfUUID value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_uuid_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setULItem(const mxfKey *itemKey, mxfUL value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_ul_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setAUIDItem(const mxfKey *itemKey, mxfAUID value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_auid_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setUMIDItem(const mxfKey *itemKey, mxfUMID value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_umid_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setTimestampItem(const mxfKey *itemKey, mxfTimestamp value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_timestamp_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setLengthItem(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_length_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setRationalItem(const mxfKey *itemKey, mxfRational value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_rational_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setPositionItem(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_position_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setBooleanItem(const mxfKey *itemKey, bool value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_boolean_item(_cMetadataSet, itemKey, value));
 }
 
 void MetadataSet::setProductVersionItem(const mxfKey *itemKey, mxfProductVersion value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_product_version_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setRGBALayoutItem(const mxfKey *itemKey, mxfRGBALayout value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_rgba_layout_item(_cMetadataSet, itemKey, &value));
 }
 
 void MetadataSet::setStringItem(const mxfKey *itemKey, string value)
 {
+    markModified();
     mxfUTF16Char *utf16Val = 0;
     size_t utf16ValSize;
     try
@@ -947,6 +1297,7 @@ void MetadataSet::setStringItem(const mxfKey *itemKey, string value)
 
 void MetadataSet::setFixedSizeStringItem(const mxfKey *itemKey, string value, uint16_t size)
 {
+    markModified();
     mxfUTF16Char *utf16Val = 0;
     size_t utf16ValSize;
     try
@@ -971,28 +1322,33 @@ void MetadataSet::setFixedSizeStringItem(const mxfKey *itemKey, string value, ui
 
 void MetadataSet::setUTF8StringItem(const mxfKey *itemKey, string value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_utf8string_item(_cMetadataSet, itemKey, value.c_str()));
 }
 
 void MetadataSet::setISO7StringItem(const mxfKey *itemKey, string value)
 {
+    markModified();
     MXFPP_CHECK(mxf_set_iso7string_item(_cMetadataSet, itemKey, value.c_str()));
 }
 
 void MetadataSet::setStrongRefItem(const mxfKey *itemKey, MetadataSet *value)
 {
+    markModified();
     MXFPP_CHECK(value->getCMetadataSet() != 0);
     MXFPP_CHECK(mxf_set_strongref_item(_cMetadataSet, itemKey, value->getCMetadataSet()));
 }
 
 void MetadataSet::setWeakRefItem(const mxfKey *itemKey, MetadataSet *value)
 {
+    markModified();
     MXFPP_CHECK(value->getCMetadataSet() != 0);
     MXFPP_CHECK(mxf_set_weakref_item(_cMetadataSet, itemKey, value->getCMetadataSet()));
 }
 
 void MetadataSet::setUInt8ArrayItem(const mxfKey *itemKey, const vector<uint8_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 1, (uint32_t)value.size(), &data));
@@ -1005,6 +1361,7 @@ void MetadataSet::setUInt8ArrayItem(const mxfKey *itemKey, const vector<uint8_t>
 
 void MetadataSet::setUInt16ArrayItem(const mxfKey *itemKey, const vector<uint16_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 2, (uint32_t)value.size(), &data));
@@ -1017,6 +1374,7 @@ void MetadataSet::setUInt16ArrayItem(const mxfKey *itemKey, const vector<uint16_
 
 void MetadataSet::setUInt32ArrayItem(const mxfKey *itemKey, const vector<uint32_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 4, (uint32_t)value.size(), &data));
@@ -1029,6 +1387,7 @@ void MetadataSet::setUInt32ArrayItem(const mxfKey *itemKey, const vector<uint32_
 
 void MetadataSet::setUInt64ArrayItem(const mxfKey *itemKey, const vector<uint64_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 8, (uint32_t)value.size(), &data));
@@ -1041,6 +1400,7 @@ void MetadataSet::setUInt64ArrayItem(const mxfKey *itemKey, const vector<uint64_
 
 void MetadataSet::setInt8ArrayItem(const mxfKey *itemKey, const vector<int8_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 1, (uint32_t)value.size(), &data));
@@ -1053,6 +1413,7 @@ void MetadataSet::setInt8ArrayItem(const mxfKey *itemKey, const vector<int8_t> &
 
 void MetadataSet::setInt16ArrayItem(const mxfKey *itemKey, const vector<int16_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 2, (uint32_t)value.size(), &data));
@@ -1065,6 +1426,7 @@ void MetadataSet::setInt16ArrayItem(const mxfKey *itemKey, const vector<int16_t>
 
 void MetadataSet::setInt32ArrayItem(const mxfKey *itemKey, const vector<int32_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 4, (uint32_t)value.size(), &data));
@@ -1077,6 +1439,7 @@ void MetadataSet::setInt32ArrayItem(const mxfKey *itemKey, const vector<int32_t>
 
 void MetadataSet::setInt64ArrayItem(const mxfKey *itemKey, const vector<int64_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 8, (uint32_t)value.size(), &data));
@@ -1089,6 +1452,7 @@ void MetadataSet::setInt64ArrayItem(const mxfKey *itemKey, const vector<int64_t>
 
 void MetadataSet::setFloatArrayItem(const mxfKey *itemKey, const vector<float> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 4, (uint32_t)value.size(), &data));
@@ -1101,6 +1465,7 @@ void MetadataSet::setFloatArrayItem(const mxfKey *itemKey, const vector<float> &
 
 void MetadataSet::setVersionTypeArrayItem(const mxfKey *itemKey, const vector<mxfVersionType> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfVersionType_extlen, (uint32_t)value.size(), &data));
@@ -1113,6 +1478,7 @@ void MetadataSet::setVersionTypeArrayItem(const mxfKey *itemKey, const vector<mx
 
 void MetadataSet::setUUIDArrayItem(const mxfKey *itemKey, const vector<mxfUUID> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfUUID_extlen, (uint32_t)value.size(), &data));
@@ -1125,6 +1491,7 @@ void MetadataSet::setUUIDArrayItem(const mxfKey *itemKey, const vector<mxfUUID>
 
 void MetadataSet::setULArrayItem(const mxfKey *itemKey, const vector<mxfUL> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfUL_extlen, (uint32_t)value.size(), &data));
@@ -1137,6 +1504,7 @@ void MetadataSet::setULArrayItem(const mxfKey *itemKey, const vector<mxfUL> &val
 
 void MetadataSet::setAUIDArrayItem(const mxfKey *itemKey, const vector<mxfAUID> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfAUID_extlen, (uint32_t)value.size(), &data));
@@ -1149,6 +1517,7 @@ void MetadataSet::setAUIDArrayItem(const mxfKey *itemKey, const vector<mxfAUID>
 
 void MetadataSet::setUMIDArrayItem(const mxfKey *itemKey, const vector<mxfUMID> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfUMID_extlen, (uint32_t)value.size(), &data));
@@ -1161,6 +1530,7 @@ void MetadataSet::setUMIDArrayItem(const mxfKey *itemKey, const vector<mxfUMID>
 
 void MetadataSet::setTimestampArrayItem(const mxfKey *itemKey, const vector<mxfTimestamp> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfTimestamp_extlen, (uint32_t)value.size(), &data));
@@ -1173,6 +1543,7 @@ void MetadataSet::setTimestampArrayItem(const mxfKey *itemKey, const vector<mxfT
 
 void MetadataSet::setLengthArrayItem(const mxfKey *itemKey, const vector<int64_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 8, (uint32_t)value.size(), &data));
@@ -1185,6 +1556,7 @@ void MetadataSet::setLengthArrayItem(const mxfKey *itemKey, const vector<int64_t
 
 void MetadataSet::setRationalArrayItem(const mxfKey *itemKey, const vector<mxfRational> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfRational_extlen, (uint32_t)value.size(), &data));
@@ -1197,6 +1569,7 @@ void MetadataSet::setRationalArrayItem(const mxfKey *itemKey, const vector<mxfRa
 
 void MetadataSet::setPositionArrayItem(const mxfKey *itemKey, const vector<int64_t> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, 8, (uint32_t)value.size(), &data));
@@ -1209,6 +1582,7 @@ void MetadataSet::setPositionArrayItem(const mxfKey *itemKey, const vector<int64
 
 void MetadataSet::setBooleanArrayItem(const mxfKey *itemKey, const vector<bool> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfBoolean_extlen, (uint32_t)value.size(), &data));
@@ -1221,6 +1595,7 @@ void MetadataSet::setBooleanArrayItem(const mxfKey *itemKey, const vector<bool>
 
 void MetadataSet::setProductVersionArrayItem(const mxfKey *itemKey, const vector<mxfProductVersion> &value)
 {
+    markModified();
     size_t i;
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfProductVersion_extlen, (uint32_t)value.size(), &data));
@@ -1233,6 +1608,7 @@ void MetadataSet::setProductVersionArrayItem(const mxfKey *itemKey, const vector
 
 void MetadataSet::setStrongRefArrayItem(const mxfKey *itemKey, ObjectIterator *iter)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfUUID_extlen, iter->size(), &data));
     while (iter->next())
@@ -1245,6 +1621,7 @@ void MetadataSet::setStrongRefArrayItem(const mxfKey *itemKey, ObjectIterator *i
 
 void MetadataSet::setWeakRefArrayItem(const mxfKey *itemKey, ObjectIterator *iter)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfUUID_extlen, iter->size(), &data));
     while (iter->next())
@@ -1257,6 +1634,7 @@ void MetadataSet::setWeakRefArrayItem(const mxfKey *itemKey, ObjectIterator *ite
 
 void MetadataSet::appendUInt8ArrayItem(const mxfKey *itemKey, uint8_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 1, 1, &data));
     mxf_set_uint8(value, data);
@@ -1264,6 +1642,7 @@ void MetadataSet::appendUInt8ArrayItem(const mxfKey *itemKey, uint8_t value)
 
 void MetadataSet::appendUInt16ArrayItem(const mxfKey *itemKey, uint16_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 2, 1, &data));
     mxf_set_uint16(value, data);
@@ -1271,6 +1650,7 @@ void MetadataSet::appendUInt16ArrayItem(const mxfKey *itemKey, uint16_t value)
 
 void MetadataSet::appendUInt32ArrayItem(const mxfKey *itemKey, uint32_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 4, 1, &data));
     mxf_set_uint32(value, data);
@@ -1278,6 +1658,7 @@ void MetadataSet::appendUInt32ArrayItem(const mxfKey *itemKey, uint32_t value)
 
 void MetadataSet::appendUInt64ArrayItem(const mxfKey *itemKey, uint64_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 8, 1, &data));
     mxf_set_uint64(value, data);
@@ -1285,6 +1666,7 @@ void MetadataSet::appendUInt64ArrayItem(const mxfKey *itemKey, uint64_t value)
 
 void MetadataSet::appendInt8ArrayItem(const mxfKey *itemKey, int8_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 1, 1, &data));
     mxf_set_int8(value, data);
@@ -1292,6 +1674,7 @@ void MetadataSet::appendInt8ArrayItem(const mxfKey *itemKey, int8_t value)
 
 void MetadataSet::appendInt16ArrayItem(const mxfKey *itemKey, int16_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 2, 1, &data));
     mxf_set_int16(value, data);
@@ -1299,6 +1682,7 @@ void MetadataSet::appendInt16ArrayItem(const mxfKey *itemKey, int16_t value)
 
 void MetadataSet::appendInt32ArrayItem(const mxfKey *itemKey, int32_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 4, 1, &data));
     mxf_set_int32(value, data);
@@ -1306,6 +1690,7 @@ void MetadataSet::appendInt32ArrayItem(const mxfKey *itemKey, int32_t value)
 
 void MetadataSet::appendInt64ArrayItem(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 8, 1, &data));
     mxf_set_int64(value, data);
@@ -1313,6 +1698,7 @@ void MetadataSet::appendInt64ArrayItem(const mxfKey *itemKey, int64_t value)
 
 void MetadataSet::appendFloatArrayItem(const mxfKey *itemKey, float value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 4, 1, &data));
     mxf_set_float(value, data);
@@ -1320,6 +1706,7 @@ void MetadataSet::appendFloatArrayItem(const mxfKey *itemKey, float value)
 
 void MetadataSet::appendVersionTypeArrayItem(const mxfKey *itemKey, mxfVersionType value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfVersionType_extlen, 1, &data));
     mxf_set_version_type(value, data);
@@ -1327,6 +1714,7 @@ void MetadataSet::appendVersionTypeArrayItem(const mxfKey *itemKey, mxfVersionTy
 
 void MetadataSet::appendUUIDArrayItem(const mxfKey *itemKey, mxfUUID value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfUUID_extlen, 1, &data));
     mxf_set_uuid(&value, data);
@@ -1334,6 +1722,7 @@ void MetadataSet::appendUUIDArrayItem(const mxfKey *itemKey, mxfUUID value)
 
 void MetadataSet::appendULArrayItem(const mxfKey *itemKey, mxfUL value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfUL_extlen, 1, &data));
     mxf_set_ul(&value, data);
@@ -1341,6 +1730,7 @@ void MetadataSet::appendULArrayItem(const mxfKey *itemKey, mxfUL value)
 
 void MetadataSet::appendAUIDArrayItem(const mxfKey *itemKey, mxfAUID value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfAUID_extlen, 1, &data));
     mxf_set_auid(&value, data);
@@ -1348,6 +1738,7 @@ void MetadataSet::appendAUIDArrayItem(const mxfKey *itemKey, mxfAUID value)
 
 void MetadataSet::appendUMIDArrayItem(const mxfKey *itemKey, mxfUMID value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfUMID_extlen, 1, &data));
     mxf_set_umid(&value, data);
@@ -1355,6 +1746,7 @@ void MetadataSet::appendUMIDArrayItem(const mxfKey *itemKey, mxfUMID value)
 
 void MetadataSet::appendTimestampArrayItem(const mxfKey *itemKey, mxfTimestamp value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfTimestamp_extlen, 1, &data));
     mxf_set_timestamp(&value, data);
@@ -1362,6 +1754,7 @@ void MetadataSet::appendTimestampArrayItem(const mxfKey *itemKey, mxfTimestamp v
 
 void MetadataSet::appendLengthArrayItem(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 8, 1, &data));
     mxf_set_int64(value, data);
@@ -1369,6 +1762,7 @@ void MetadataSet::appendLengthArrayItem(const mxfKey *itemKey, int64_t value)
 
 void MetadataSet::appendRationalArrayItem(const mxfKey *itemKey, mxfRational value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfRational_extlen, 1, &data));
     mxf_set_rational(&value, data);
@@ -1376,6 +1770,7 @@ void MetadataSet::appendRationalArrayItem(const mxfKey *itemKey, mxfRational val
 
 void MetadataSet::appendPositionArrayItem(const mxfKey *itemKey, int64_t value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, 8, 1, &data));
     mxf_set_int64(value, data);
@@ -1383,6 +1778,7 @@ void MetadataSet::appendPositionArrayItem(const mxfKey *itemKey, int64_t value)
 
 void MetadataSet::appendBooleanArrayItem(const mxfKey *itemKey, bool value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfBoolean_extlen, 1, &data));
     mxf_set_boolean(value, data);
@@ -1390,6 +1786,7 @@ void MetadataSet::appendBooleanArrayItem(const mxfKey *itemKey, bool value)
 
 void MetadataSet::appendProductVersionArrayItem(const mxfKey *itemKey, mxfProductVersion value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfProductVersion_extlen, 1, &data));
     mxf_set_product_version(&value, data);
@@ -1397,17 +1794,20 @@ void MetadataSet::appendProductVersionArrayItem(const mxfKey *itemKey, mxfProduc
 
 void MetadataSet::appendStrongRefArrayItem(const mxfKey *itemKey, MetadataSet *value)
 {
+    markModified();
     MXFPP_CHECK(mxf_add_array_item_strongref(_cMetadataSet, itemKey, value->getCMetadataSet()));
 }
 
 void MetadataSet::appendWeakRefArrayItem(const mxfKey *itemKey, MetadataSet *value)
 {
+    markModified();
     MXFPP_CHECK(mxf_add_array_item_weakref(_cMetadataSet, itemKey, value->getCMetadataSet()));
 }
 
 
 void MetadataSet::removeItem(const mxfKey *itemKey)
 {
+    markModified();
     MXFMetadataItem *item;
     MXFPP_CHECK(mxf_remove_item(_cMetadataSet, itemKey, &item));
     mxf_free_item(&item);
@@ -1430,6 +1830,7 @@ bool MetadataSet::validate(bool logErrors)
 
 void MetadataSet::setAvidRGBColor(const mxfKey *itemKey, uint16_t red, uint16_t green, uint16_t blue)
 {
+    markModified();
     RGBColor color;
     color.red = red;
     color.green = green;
@@ -1439,6 +1840,7 @@ void MetadataSet::setAvidRGBColor(const mxfKey *itemKey, uint16_t red, uint16_t
 
 void MetadataSet::setAvidProductVersion(const mxfKey *itemKey, mxfProductVersion value)
 {
+    markModified();
     MXFPP_CHECK(mxf_avid_set_product_version_item(_cMetadataSet, itemKey, &value));
 }
 
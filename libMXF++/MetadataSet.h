@@ -34,6 +34,9 @@
 
 #include <map>
 #include <vector>
+#include <iterator>
+#include <cstddef>
+#include <cstring>
 
 
 
@@ -111,6 +114,91 @@ private:
 };
 
 
+// a view over the elements of an array item value that decodes each element on access
+// the view is invalidated when the item is changed or the set is deleted
+template <typename T>
+class ArrayItemView
+{
+public:
+    typedef void (*DecodeFunc)(const uint8_t *element, T *value);
+
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef T reference;
+
+        const_iterator() : _element(0), _elementLength(0), _decode(0) {}
+        const_iterator(const uint8_t *element, uint32_t elementLength, DecodeFunc decode)
+        : _element(element), _elementLength(elementLength), _decode(decode) {}
+
+        T operator*() const
+        {
+            T value;
+            _decode(_element, &value);
+            return value;
+        }
+        const_iterator& operator++()
+        {
+            _element += _elementLength;
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator prev = *this;
+            _element += _elementLength;
+            return prev;
+        }
+        bool operator==(const const_iterator &right) const { return _element == right._element; }
+        bool operator!=(const const_iterator &right) const { return _element != right._element; }
+
+        const uint8_t* getElementData() const { return _element; }
+
+    private:
+        const uint8_t *_element;
+        uint32_t _elementLength;
+        DecodeFunc _decode;
+    };
+
+public:
+    ArrayItemView()
+    : _data(0), _size(0), _elementLength(0), _decode(0) {}
+    ArrayItemView(const uint8_t *data, uint32_t size, uint32_t elementLength, DecodeFunc decode)
+    : _data(data), _size(size), _elementLength(elementLength), _decode(decode) {}
+
+    uint32_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    uint32_t getElementLength() const { return _elementLength; }
+
+    const uint8_t* getElementData(uint32_t index) const { return _data + index * _elementLength; }
+
+    T operator[](uint32_t index) const
+    {
+        T value;
+        _decode(getElementData(index), &value);
+        return value;
+    }
+    T at(uint32_t index) const
+    {
+        if (index >= _size)
+            throw MXFException("Array item view index %u is out of range", index);
+        return (*this)[index];
+    }
+
+    const_iterator begin() const { return const_iterator(_data, _elementLength, _decode); }
+    const_iterator end() const   { return const_iterator(_data + _size * _elementLength, _elementLength, _decode); }
+
+private:
+    const uint8_t *_data;
+    uint32_t _size;
+    uint32_t _elementLength;
+    DecodeFunc _decode;
+};
+
+
 class HeaderMetadata;
 
 class MetadataSet
@@ -118,6 +206,18 @@ class MetadataSet
 public:
     friend class HeaderMetadata;
 
+public:
+    // wrappers created by the object factory are allocated from the header metadata arena if enabled
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, MemoryArena *arena);
+    static void operator delete(void *ptr);
+    static void operator delete(void *ptr, MemoryArena *arena);
+
+    // the size of the wrapper allocation, including the allocation prefix
+    size_t getAllocationSize() const;
+    // the size of the encoded set and reference array caches
+    size_t getCacheSize() const;
+
 public:
     MetadataSet(const MetadataSet &set);
     virtual ~MetadataSet();
@@ -152,6 +252,10 @@ public:
     std::string getStringItem(const mxfKey *itemKey) const;
     std::string getUTF8StringItem(const mxfKey *itemKey) const;
     std::string getISO7StringItem(const mxfKey *itemKey) const;
+    // transcode the UTF-16 string item into the caller's buffer without intermediate allocations
+    // returns the UTF-8 length excluding the null terminator; the result is truncated if >= bufferSize
+    size_t getStringItem(const mxfKey *itemKey, char *buffer, size_t bufferSize) const;
+    void getStringItem(const mxfKey *itemKey, std::string *value) const;
     MetadataSet* getStrongRefItem(const mxfKey *itemKey) const;
     MetadataSet* getStrongRefItemLight(const mxfKey *itemKey) const;
     MetadataSet* getWeakRefItem(const mxfKey *itemKey) const;
@@ -178,9 +282,75 @@ public:
     std::vector<bool> getBooleanArrayItem(const mxfKey *itemKey) const;
     std::vector<mxfProductVersion> getProductVersionArrayItem(const mxfKey *itemKey) const;
 
+    ArrayItemView<uint8_t> getUInt8ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<uint16_t> getUInt16ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<uint32_t> getUInt32ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<uint64_t> getUInt64ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<int8_t> getInt8ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<int16_t> getInt16ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<int32_t> getInt32ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<int64_t> getInt64ArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<mxfUUID> getUUIDArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<mxfUL> getULArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<mxfUMID> getUMIDArrayItemView(const mxfKey *itemKey) const;
+    ArrayItemView<mxfRational> getRationalArrayItemView(const mxfKey *itemKey) const;
+
     ObjectIterator* getStrongRefArrayItem(const mxfKey *itemKey) const;
     ObjectIterator* getWeakRefArrayItem(const mxfKey *itemKey) const;
 
+    // resolves all strong or weak references in the array item in one pass
+    // the result is cached until the item is modified or a referenced set's wrapper changes
+    // the returned reference is only valid until the next call
+    const std::vector<MetadataSet*>& dereferenceRefArrayItem(const mxfKey *itemKey) const;
+
+    // typed access to fixed size items using the descriptors in the generated classes,
+    // e.g. getItem<GenericPictureEssenceDescriptor::StoredWidthItem>()
+    template <class Item>
+    bool haveItem() const
+    {
+        return findItem(Item::key(), Item::localTag) != 0;
+    }
+
+    template <class Item>
+    typename Item::ValueType getItem() const
+    {
+        const ::MXFMetadataItem *item = findItem(Item::key(), Item::localTag);
+        MXFPP_CHECK(item != 0 && item->length == Item::size);
+        typename Item::ValueType value;
+        Item::Traits::decode(item->value, &value);
+        return value;
+    }
+
+    template <class Item>
+    void setItem(typename Item::ValueType value)
+    {
+        markModified();
+        uint8_t buffer[Item::size];
+        Item::Traits::encode(value, buffer);
+        ::MXFMetadataItem *item = findItem(Item::key(), Item::localTag);
+        if (item != 0 && item->length == Item::size)
+            memcpy(item->value, buffer, Item::size);
+        else
+            MXFPP_CHECK(mxf_set_item(_cMetadataSet, Item::key(), buffer, Item::size));
+    }
+
+    // finds the item, comparing the local tag first if localTagHint is non-zero
+    ::MXFMetadataItem* findItem(const mxfKey *itemKey, mxfLocalTag localTagHint = 0) const;
+
+    template <class T>
+    std::vector<T*> getRefArrayItemSets(const mxfKey *itemKey) const
+    {
+        const std::vector<MetadataSet*> &sets = dereferenceRefArrayItem(itemKey);
+        std::vector<T*> result(sets.size());
+        size_t i;
+        for (i = 0; i < sets.size(); i++)
+        {
+            result[i] = dynamic_cast<T*>(sets[i]);
+            MXFPP_CHECK(result[i] != 0);
+        }
+        return result;
+    }
+
 
     void setRawBytesItem(const mxfKey *itemKey, ByteArray value);
 
@@ -273,6 +443,18 @@ public:
     void setAvidProductVersion(const mxfKey *itemKey, mxfProductVersion value);
 
 
+    // the modification count is incremented by every set, append and remove item call
+    // call markModified() after changing the C metadata set directly
+    void markModified();
+    uint32_t getModificationCount() const { return _modificationCount; }
+
+
+    // the kind is set by the generated class constructors and is used to classify sets without dynamic_cast
+    MetadataSetKind getSetKind() const { return _setKind; }
+    uint64_t getSetKindMask() const { return _setKindMask; }
+    bool isKindOf(MetadataSetKind kind) const { return (_setKindMask & ((uint64_t)1 << kind)) != 0; }
+
+
     HeaderMetadata* getHeaderMetadata() const { return _headerMetadata; }
 
     ::MXFMetadataSet* getCMetadataSet() const { return _cMetadataSet; }
@@ -281,17 +463,62 @@ public:
 protected:
     MetadataSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet);
 
+    void setSetKind(MetadataSetKind kind)
+    {
+        _setKind = kind;
+        _setKindMask |= (uint64_t)1 << kind;
+    }
+
     HeaderMetadata* _headerMetadata;
     ::MXFMetadataSet* _cMetadataSet;
+
+private:
+    typedef struct
+    {
+        mxfKey itemKey;
+        uint32_t modificationCount;
+        uint32_t wrapperGeneration;
+        std::vector<MetadataSet*> sets;
+    } RefArrayCache;
+
+private:
+    const uint8_t* getArrayItemElements(const mxfKey *itemKey, uint32_t elementLength, uint32_t *size) const;
+
+    MetadataSetKind _setKind;
+    uint64_t _setKindMask;
+    uint32_t _modificationCount;
+
+    // the KLV bytes written by the HeaderMetadata write cache
+    std::vector<unsigned char> _encodedBytes;
+    uint32_t _encodedModificationCount;
+    uint8_t _encodedLLen;
+
+    mutable std::vector<RefArrayCache> _refArrayCaches;
 };
 
 
+// returns the set as a T if it is of T's kind or a sub-class kind, else returns 0
+template <class T>
+inline T* metadata_set_cast(MetadataSet *set)
+{
+    if (set == 0 || !set->isKindOf(T::SET_KIND))
+        return 0;
+    return static_cast<T*>(set);
+}
+
+
 class AbsMetadataSetFactory
 {
 public:
     virtual ~AbsMetadataSetFactory() {};
 
     virtual MetadataSet* create(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet) = 0;
+
+    virtual MetadataSet* create(HeaderMetadata *headerMetadata, ::MXFMetadataSet *metadataSet, MemoryArena *arena)
+    {
+        (void)arena;
+        return create(headerMetadata, metadataSet);
+    }
 };
 
 template<class MetadataSetType>
@@ -302,6 +529,11 @@ public:
     {
         return new MetadataSetType(headerMetadata, cMetadataSet);
     }
+
+    virtual MetadataSet* create(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet, MemoryArena *arena)
+    {
+        return new (arena) MetadataSetType(headerMetadata, cMetadataSet);
+    }
 };
 
 
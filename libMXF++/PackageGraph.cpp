@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define MAX_REFERENCE_DEPTH     32
+
+
+
+PackageGraph::PackageGraph(HeaderMetadata *headerMetadata)
+{
+    vector<GenericPackage*> packages = headerMetadata->getPreface()->getContentStorage()->getPackages();
+    size_t i;
+    for (i = 0; i < packages.size(); i++) {
+        mxfUMID packageUID = packages[i]->getPackageUID();
+        _packages.insert(make_pair(packageUID, packages[i]));
+
+        vector<GenericTrack*> tracks = packages[i]->getTracks();
+        size_t j;
+        for (j = 0; j < tracks.size(); j++) {
+            if (tracks[j]->haveTrackID())
+                _tracks.insert(make_pair(TrackKey(packageUID, tracks[j]->getTrackID()), tracks[j]));
+        }
+    }
+
+    for (i = 0; i < packages.size(); i++) {
+        if (!packages[i]->isKindOf(MATERIALPACKAGE_SET_KIND))
+            continue;
+
+        vector<GenericTrack*> tracks = packages[i]->getTracks();
+        size_t j;
+        for (j = 0; j < tracks.size(); j++) {
+            MaterialTrackChain chain;
+            chain.materialPackage = packages[i];
+            chain.materialTrack = tracks[j];
+            chain.sourceClip = getSingleSourceClip(tracks[j]);
+            chain.fileSourcePackage = 0;
+            chain.fileSourceTrack = 0;
+            if (chain.sourceClip) {
+                bool complete;
+                FileSourceRef ref = resolve(TrackKey(chain.sourceClip->getSourcePackageID(),
+                                                     chain.sourceClip->getSourceTrackID()), 0, &complete);
+                chain.fileSourcePackage = ref.first;
+                chain.fileSourceTrack = ref.second;
+            }
+
+            _materialTrackIndex[tracks[j]] = _materialTrackChains.size();
+            _materialTrackChains.push_back(chain);
+        }
+    }
+}
+
+PackageGraph::~PackageGraph()
+{
+}
+
+GenericPackage* PackageGraph::findPackage(const mxfUMID &packageUID) const
+{
+    PackageMap::const_iterator iter = _packages.find(packageUID);
+    if (iter == _packages.end())
+        return 0;
+
+    return iter->second;
+}
+
+GenericTrack* PackageGraph::findTrack(const mxfUMID &packageUID, uint32_t trackId) const
+{
+    TrackMap::const_iterator iter = _tracks.find(TrackKey(packageUID, trackId));
+    if (iter == _tracks.end())
+        return 0;
+
+    return iter->second;
+}
+
+const PackageGraph::MaterialTrackChain* PackageGraph::findMaterialTrackChain(GenericTrack *materialTrack) const
+{
+    map<GenericTrack*, size_t>::const_iterator iter = _materialTrackIndex.find(materialTrack);
+    if (iter == _materialTrackIndex.end())
+        return 0;
+
+    return &_materialTrackChains[iter->second];
+}
+
+SourcePackage* PackageGraph::resolveFileSourcePackage(const mxfUMID &packageUID, uint32_t trackId,
+                                                      GenericTrack **fileSourceTrack) const
+{
+    bool complete;
+    FileSourceRef ref = resolve(TrackKey(packageUID, trackId), 0, &complete);
+    if (fileSourceTrack)
+        *fileSourceTrack = ref.second;
+
+    return ref.first;
+}
+
+void PackageGraph::resolveAll()
+{
+    bool complete;
+    TrackMap::const_iterator iter;
+    for (iter = _tracks.begin(); iter != _tracks.end(); iter++)
+        resolve(iter->first, 0, &complete);
+}
+
+SourceClip* PackageGraph::getSingleSourceClip(GenericTrack *track)
+{
+    StructuralComponent *component = track->getSequence();
+
+    Sequence *sequence = metadata_set_cast<Sequence>(component);
+    if (sequence) {
+        vector<StructuralComponent*> components = sequence->getStructuralComponents();
+        if (components.size() != 1)
+            return 0;
+        component = components[0];
+    }
+
+    return metadata_set_cast<SourceClip>(component);
+}
+
+PackageGraph::FileSourceRef PackageGraph::resolve(const TrackKey &trackKey, int depth, bool *complete) const
+{
+    *complete = true;
+
+    ResolvedMap::const_iterator resolvedIter = _resolved.find(trackKey);
+    if (resolvedIter != _resolved.end())
+        return resolvedIter->second;
+
+    FileSourceRef ref(0, 0);
+    GenericPackage *package = findPackage(trackKey.first);
+    GenericTrack *track = findTrack(trackKey.first, trackKey.second);
+    if (package && track) {
+        SourcePackage *sourcePackage = metadata_set_cast<SourcePackage>(package);
+        if (sourcePackage && sourcePackage->haveDescriptor() &&
+            metadata_set_cast<FileDescriptor>(sourcePackage->getDescriptorLight()))
+        {
+            ref = FileSourceRef(sourcePackage, track);
+        }
+        else
+        {
+            SourceClip *sourceClip = getSingleSourceClip(track);
+            if (sourceClip) {
+                if (depth < MAX_REFERENCE_DEPTH) {
+                    ref = resolve(TrackKey(sourceClip->getSourcePackageID(), sourceClip->getSourceTrackID()),
+                                  depth + 1, complete);
+                } else {
+                    *complete = false;
+                }
+            }
+        }
+
+        // a chain cut short by the depth limit may resolve when starting from a later track
+        if (*complete)
+            _resolved[trackKey] = ref;
+    }
+
+    return ref;
+}
+
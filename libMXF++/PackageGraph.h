@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_PACKAGE_GRAPH_H_
+#define MXFPP_PACKAGE_GRAPH_H_
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace mxfpp
+{
+
+
+// An index of the packages in the content storage, their tracks and the material track to file source package
+// references. Use HeaderMetadata::getPackageGraph() to get a graph that is rebuilt after the metadata changes
+
+class PackageGraph
+{
+public:
+    typedef struct
+    {
+        GenericPackage *materialPackage;
+        GenericTrack *materialTrack;
+        SourceClip *sourceClip;             // the material track's single source clip, or 0
+        SourcePackage *fileSourcePackage;   // the file source package at the end of the reference chain, or 0
+        GenericTrack *fileSourceTrack;
+    } MaterialTrackChain;
+
+public:
+    PackageGraph(HeaderMetadata *headerMetadata);
+    ~PackageGraph();
+
+    GenericPackage* findPackage(const mxfUMID &packageUID) const;
+    GenericTrack* findTrack(const mxfUMID &packageUID, uint32_t trackId) const;
+
+    const std::vector<MaterialTrackChain>& getMaterialTrackChains() const { return _materialTrackChains; }
+    const MaterialTrackChain* findMaterialTrackChain(GenericTrack *materialTrack) const;
+
+    // follows the source clip references to a file source package
+    SourcePackage* resolveFileSourcePackage(const mxfUMID &packageUID, uint32_t trackId,
+                                            GenericTrack **fileSourceTrack) const;
+
+    // resolves the references for all tracks so that the graph is not modified by later calls
+    void resolveAll();
+
+private:
+    typedef std::pair<mxfUMID, uint32_t> TrackKey;
+    typedef std::pair<SourcePackage*, GenericTrack*> FileSourceRef;
+
+    struct TrackKeyHash
+    {
+        size_t operator()(const TrackKey &trackKey) const
+        {
+            return std::hash<mxfUMID>()(trackKey.first) ^ (trackKey.second * 0x9e3779b9U);
+        }
+    };
+
+    typedef std::unordered_map<mxfUMID, GenericPackage*> PackageMap;
+    typedef std::unordered_map<TrackKey, GenericTrack*, TrackKeyHash> TrackMap;
+    typedef std::unordered_map<TrackKey, FileSourceRef, TrackKeyHash> ResolvedMap;
+
+    static SourceClip* getSingleSourceClip(GenericTrack *track);
+
+    FileSourceRef resolve(const TrackKey &trackKey, int depth, bool *complete) const;
+
+    PackageMap _packages;
+    TrackMap _tracks;
+    std::vector<MaterialTrackChain> _materialTrackChains;
+    std::map<GenericTrack*, size_t> _materialTrackIndex;
+    mutable ResolvedMap _resolved;
+};
+
+
+};
+
+
+
+#endif
@@ -153,14 +153,7 @@ int32_t TaggedValue::getInt32Value()
 
 vector<TaggedValue*> TaggedValue::getAvidAttributes()
 {
-    vector<TaggedValue*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(TaggedValue, TaggedValueAttributeList)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<TaggedValue*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<TaggedValue*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<TaggedValue>(&MXF_ITEM_K(TaggedValue, TaggedValueAttributeList));
 }
 
 void TaggedValue::setName(string value)
@@ -170,6 +163,7 @@ void TaggedValue::setName(string value)
 
 void TaggedValue::setValue(string value)
 {
+    markModified();
     mxfUTF16Char *utf16Val = 0;
     size_t utf16ValSize;
     try
@@ -193,6 +187,7 @@ void TaggedValue::setValue(string value)
 
 void TaggedValue::setValue(int32_t value)
 {
+    markModified();
     MXFPP_CHECK(mxf_avid_set_indirect_int32_item(_cMetadataSet, &MXF_ITEM_K(TaggedValue, Value), value));
 }
 
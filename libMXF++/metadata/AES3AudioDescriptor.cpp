@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 AES3AudioDescriptor::AES3AudioDescriptor(HeaderMetadata *headerMetadata)
 : AES3AudioDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(AES3AUDIODESCRIPTOR_SET_KIND);
+}
 
 AES3AudioDescriptor::AES3AudioDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : AES3AudioDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(AES3AUDIODESCRIPTOR_SET_KIND);
+}
 
 AES3AudioDescriptor::~AES3AudioDescriptor()
 {}
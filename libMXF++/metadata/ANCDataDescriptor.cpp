@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 ANCDataDescriptor::ANCDataDescriptor(HeaderMetadata *headerMetadata)
 : ANCDataDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(ANCDATADESCRIPTOR_SET_KIND);
+}
 
 ANCDataDescriptor::ANCDataDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : ANCDataDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(ANCDATADESCRIPTOR_SET_KIND);
+}
 
 ANCDataDescriptor::~ANCDataDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 AVCSubDescriptor::AVCSubDescriptor(HeaderMetadata *headerMetadata)
 : AVCSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(AVCSUBDESCRIPTOR_SET_KIND);
+}
 
 AVCSubDescriptor::AVCSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : AVCSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(AVCSUBDESCRIPTOR_SET_KIND);
+}
 
 AVCSubDescriptor::~AVCSubDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 AudioChannelLabelSubDescriptor::AudioChannelLabelSubDescriptor(HeaderMetadata *headerMetadata)
 : AudioChannelLabelSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(AUDIOCHANNELLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 AudioChannelLabelSubDescriptor::AudioChannelLabelSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : AudioChannelLabelSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(AUDIOCHANNELLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 AudioChannelLabelSubDescriptor::~AudioChannelLabelSubDescriptor()
 {}
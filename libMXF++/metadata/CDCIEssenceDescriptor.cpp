@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 CDCIEssenceDescriptor::CDCIEssenceDescriptor(HeaderMetadata *headerMetadata)
 : CDCIEssenceDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(CDCIESSENCEDESCRIPTOR_SET_KIND);
+}
 
 CDCIEssenceDescriptor::CDCIEssenceDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : CDCIEssenceDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(CDCIESSENCEDESCRIPTOR_SET_KIND);
+}
 
 CDCIEssenceDescriptor::~CDCIEssenceDescriptor()
 {}
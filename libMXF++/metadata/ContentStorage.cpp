@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 ContentStorage::ContentStorage(HeaderMetadata *headerMetadata)
 : ContentStorageBase(headerMetadata)
-{}
+{
+    setSetKind(CONTENTSTORAGE_SET_KIND);
+}
 
 ContentStorage::ContentStorage(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : ContentStorageBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(CONTENTSTORAGE_SET_KIND);
+}
 
 ContentStorage::~ContentStorage()
 {}
@@ -41,11 +41,15 @@ using namespace mxfpp;
 
 DCTimedTextDescriptor::DCTimedTextDescriptor(HeaderMetadata *headerMetadata)
 : DCTimedTextDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(DCTIMEDTEXTDESCRIPTOR_SET_KIND);
+}
 
 DCTimedTextDescriptor::DCTimedTextDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DCTimedTextDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DCTIMEDTEXTDESCRIPTOR_SET_KIND);
+}
 
 DCTimedTextDescriptor::~DCTimedTextDescriptor()
 {}
@@ -41,11 +41,15 @@ using namespace mxfpp;
 
 DCTimedTextResourceSubDescriptor::DCTimedTextResourceSubDescriptor(HeaderMetadata *headerMetadata)
 : DCTimedTextResourceSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(DCTIMEDTEXTRESOURCESUBDESCRIPTOR_SET_KIND);
+}
 
 DCTimedTextResourceSubDescriptor::DCTimedTextResourceSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DCTimedTextResourceSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DCTIMEDTEXTRESOURCESUBDESCRIPTOR_SET_KIND);
+}
 
 DCTimedTextResourceSubDescriptor::~DCTimedTextResourceSubDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 DMFramework::DMFramework(HeaderMetadata *headerMetadata)
 : DMFrameworkBase(headerMetadata)
-{}
+{
+    setSetKind(DMFRAMEWORK_SET_KIND);
+}
 
 DMFramework::DMFramework(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DMFrameworkBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DMFRAMEWORK_SET_KIND);
+}
 
 DMFramework::~DMFramework()
 {}
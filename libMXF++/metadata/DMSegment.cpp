@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 DMSegment::DMSegment(HeaderMetadata *headerMetadata)
 : DMSegmentBase(headerMetadata)
-{}
+{
+    setSetKind(DMSEGMENT_SET_KIND);
+}
 
 DMSegment::DMSegment(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DMSegmentBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DMSEGMENT_SET_KIND);
+}
 
 DMSegment::~DMSegment()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 DMSet::DMSet(HeaderMetadata *headerMetadata)
 : DMSetBase(headerMetadata)
-{}
+{
+    setSetKind(DMSET_SET_KIND);
+}
 
 DMSet::DMSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DMSetBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DMSET_SET_KIND);
+}
 
 DMSet::~DMSet()
 {}
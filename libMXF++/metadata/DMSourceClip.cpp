@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 DMSourceClip::DMSourceClip(HeaderMetadata *headerMetadata)
 : DMSourceClipBase(headerMetadata)
-{}
+{
+    setSetKind(DMSOURCECLIP_SET_KIND);
+}
 
 DMSourceClip::DMSourceClip(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : DMSourceClipBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(DMSOURCECLIP_SET_KIND);
+}
 
 DMSourceClip::~DMSourceClip()
 {}
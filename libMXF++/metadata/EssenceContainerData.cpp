@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 EssenceContainerData::EssenceContainerData(HeaderMetadata *headerMetadata)
 : EssenceContainerDataBase(headerMetadata)
-{}
+{
+    setSetKind(ESSENCECONTAINERDATA_SET_KIND);
+}
 
 EssenceContainerData::EssenceContainerData(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : EssenceContainerDataBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(ESSENCECONTAINERDATA_SET_KIND);
+}
 
 EssenceContainerData::~EssenceContainerData()
 {}
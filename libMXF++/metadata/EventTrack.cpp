@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 EventTrack::EventTrack(HeaderMetadata *headerMetadata)
 : EventTrackBase(headerMetadata)
-{}
+{
+    setSetKind(EVENTTRACK_SET_KIND);
+}
 
 EventTrack::EventTrack(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : EventTrackBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(EVENTTRACK_SET_KIND);
+}
 
 EventTrack::~EventTrack()
 {}
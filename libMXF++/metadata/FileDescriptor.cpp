@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 FileDescriptor::FileDescriptor(HeaderMetadata *headerMetadata)
 : FileDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(FILEDESCRIPTOR_SET_KIND);
+}
 
 FileDescriptor::FileDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : FileDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(FILEDESCRIPTOR_SET_KIND);
+}
 
 FileDescriptor::~FileDescriptor()
 {}
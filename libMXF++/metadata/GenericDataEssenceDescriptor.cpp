@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericDataEssenceDescriptor::GenericDataEssenceDescriptor(HeaderMetadata *headerMetadata)
 : GenericDataEssenceDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICDATAESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericDataEssenceDescriptor::GenericDataEssenceDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericDataEssenceDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICDATAESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericDataEssenceDescriptor::~GenericDataEssenceDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericDescriptor::GenericDescriptor(HeaderMetadata *headerMetadata)
 : GenericDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICDESCRIPTOR_SET_KIND);
+}
 
 GenericDescriptor::GenericDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICDESCRIPTOR_SET_KIND);
+}
 
 GenericDescriptor::~GenericDescriptor()
 {}
@@ -47,39 +47,27 @@ using namespace mxfpp;
 
 GenericPackage::GenericPackage(HeaderMetadata *headerMetadata)
 : GenericPackageBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICPACKAGE_SET_KIND);
+}
 
 GenericPackage::GenericPackage(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericPackageBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICPACKAGE_SET_KIND);
+}
 
 GenericPackage::~GenericPackage()
 {}
 
 vector<TaggedValue*> GenericPackage::getAvidAttributes()
 {
-    vector<TaggedValue*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(GenericPackage, MobAttributeList)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<TaggedValue*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<TaggedValue*>(iter->get()));
-    }
-
-    return result;
+    return getRefArrayItemSets<TaggedValue>(&MXF_ITEM_K(GenericPackage, MobAttributeList));
 }
 
 vector<TaggedValue*> GenericPackage::getAvidUserComments()
 {
-    vector<TaggedValue*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(GenericPackage, UserComments)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<TaggedValue*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<TaggedValue*>(iter->get()));
-    }
-
-    return result;
+    return getRefArrayItemSets<TaggedValue>(&MXF_ITEM_K(GenericPackage, UserComments));
 }
 
 TaggedValue* GenericPackage::appendAvidAttribute(string name, string value)
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericPictureEssenceDescriptor::GenericPictureEssenceDescriptor(HeaderMetadata *headerMetadata)
 : GenericPictureEssenceDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICPICTUREESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericPictureEssenceDescriptor::GenericPictureEssenceDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericPictureEssenceDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICPICTUREESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericPictureEssenceDescriptor::~GenericPictureEssenceDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericSoundEssenceDescriptor::GenericSoundEssenceDescriptor(HeaderMetadata *headerMetadata)
 : GenericSoundEssenceDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICSOUNDESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericSoundEssenceDescriptor::GenericSoundEssenceDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericSoundEssenceDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICSOUNDESSENCEDESCRIPTOR_SET_KIND);
+}
 
 GenericSoundEssenceDescriptor::~GenericSoundEssenceDescriptor()
 {}
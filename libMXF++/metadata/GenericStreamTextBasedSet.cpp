@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericStreamTextBasedSet::GenericStreamTextBasedSet(HeaderMetadata *headerMetadata)
 : GenericStreamTextBasedSetBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICSTREAMTEXTBASEDSET_SET_KIND);
+}
 
 GenericStreamTextBasedSet::GenericStreamTextBasedSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericStreamTextBasedSetBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICSTREAMTEXTBASEDSET_SET_KIND);
+}
 
 GenericStreamTextBasedSet::~GenericStreamTextBasedSet()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GenericTrack::GenericTrack(HeaderMetadata *headerMetadata)
 : GenericTrackBase(headerMetadata)
-{}
+{
+    setSetKind(GENERICTRACK_SET_KIND);
+}
 
 GenericTrack::GenericTrack(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GenericTrackBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GENERICTRACK_SET_KIND);
+}
 
 GenericTrack::~GenericTrack()
 {}
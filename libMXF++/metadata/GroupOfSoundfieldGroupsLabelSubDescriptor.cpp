@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 GroupOfSoundfieldGroupsLabelSubDescriptor::GroupOfSoundfieldGroupsLabelSubDescriptor(HeaderMetadata *headerMetadata)
 : GroupOfSoundfieldGroupsLabelSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(GROUPOFSOUNDFIELDGROUPSLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 GroupOfSoundfieldGroupsLabelSubDescriptor::GroupOfSoundfieldGroupsLabelSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : GroupOfSoundfieldGroupsLabelSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(GROUPOFSOUNDFIELDGROUPSLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 GroupOfSoundfieldGroupsLabelSubDescriptor::~GroupOfSoundfieldGroupsLabelSubDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 Identification::Identification(HeaderMetadata *headerMetadata)
 : IdentificationBase(headerMetadata)
-{}
+{
+    setSetKind(IDENTIFICATION_SET_KIND);
+}
 
 Identification::Identification(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : IdentificationBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(IDENTIFICATION_SET_KIND);
+}
 
 Identification::~Identification()
 {}
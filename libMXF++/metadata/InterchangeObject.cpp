@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 InterchangeObject::InterchangeObject(HeaderMetadata *headerMetadata)
 : InterchangeObjectBase(headerMetadata)
-{}
+{
+    setSetKind(INTERCHANGEOBJECT_SET_KIND);
+}
 
 InterchangeObject::InterchangeObject(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : InterchangeObjectBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(INTERCHANGEOBJECT_SET_KIND);
+}
 
 InterchangeObject::~InterchangeObject()
 {}
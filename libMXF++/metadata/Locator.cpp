@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 Locator::Locator(HeaderMetadata *headerMetadata)
 : LocatorBase(headerMetadata)
-{}
+{
+    setSetKind(LOCATOR_SET_KIND);
+}
 
 Locator::Locator(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : LocatorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(LOCATOR_SET_KIND);
+}
 
 Locator::~Locator()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 MCALabelSubDescriptor::MCALabelSubDescriptor(HeaderMetadata *headerMetadata)
 : MCALabelSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(MCALABELSUBDESCRIPTOR_SET_KIND);
+}
 
 MCALabelSubDescriptor::MCALabelSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : MCALabelSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(MCALABELSUBDESCRIPTOR_SET_KIND);
+}
 
 MCALabelSubDescriptor::~MCALabelSubDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 MPEGVideoDescriptor::MPEGVideoDescriptor(HeaderMetadata *headerMetadata)
 : MPEGVideoDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(MPEGVIDEODESCRIPTOR_SET_KIND);
+}
 
 MPEGVideoDescriptor::MPEGVideoDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : MPEGVideoDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(MPEGVIDEODESCRIPTOR_SET_KIND);
+}
 
 MPEGVideoDescriptor::~MPEGVideoDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 MaterialPackage::MaterialPackage(HeaderMetadata *headerMetadata)
 : MaterialPackageBase(headerMetadata)
-{}
+{
+    setSetKind(MATERIALPACKAGE_SET_KIND);
+}
 
 MaterialPackage::MaterialPackage(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : MaterialPackageBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(MATERIALPACKAGE_SET_KIND);
+}
 
 MaterialPackage::~MaterialPackage()
 {}
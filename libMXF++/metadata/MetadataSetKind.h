@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2008, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_METADATA_SET_KIND_H_
+#define MXFPP_METADATA_SET_KIND_H_
+
+
+
+namespace mxfpp
+{
+
+
+// the generated class of a metadata set. A set's kind mask has a bit set for its kind and the kind of
+// each of its parent classes
+
+enum MetadataSetKind
+{
+    UNKNOWN_SET_KIND = 0,
+    INTERCHANGEOBJECT_SET_KIND,
+    SEQUENCE_SET_KIND,
+    GENERICTRACK_SET_KIND,
+    GENERICPACKAGE_SET_KIND,
+    IDENTIFICATION_SET_KIND,
+    ESSENCECONTAINERDATA_SET_KIND,
+    CONTENTSTORAGE_SET_KIND,
+    LOCATOR_SET_KIND,
+    NETWORKLOCATOR_SET_KIND,
+    TEXTLOCATOR_SET_KIND,
+    STATICTRACK_SET_KIND,
+    TRACK_SET_KIND,
+    EVENTTRACK_SET_KIND,
+    STRUCTURALCOMPONENT_SET_KIND,
+    TIMECODECOMPONENT_SET_KIND,
+    SOURCECLIP_SET_KIND,
+    DMFRAMEWORK_SET_KIND,
+    DMSEGMENT_SET_KIND,
+    DMSOURCECLIP_SET_KIND,
+    SUBDESCRIPTOR_SET_KIND,
+    GENERICDESCRIPTOR_SET_KIND,
+    FILEDESCRIPTOR_SET_KIND,
+    GENERICPICTUREESSENCEDESCRIPTOR_SET_KIND,
+    CDCIESSENCEDESCRIPTOR_SET_KIND,
+    MPEGVIDEODESCRIPTOR_SET_KIND,
+    RGBAESSENCEDESCRIPTOR_SET_KIND,
+    GENERICSOUNDESSENCEDESCRIPTOR_SET_KIND,
+    GENERICDATAESSENCEDESCRIPTOR_SET_KIND,
+    MULTIPLEDESCRIPTOR_SET_KIND,
+    WAVEAUDIODESCRIPTOR_SET_KIND,
+    AES3AUDIODESCRIPTOR_SET_KIND,
+    MATERIALPACKAGE_SET_KIND,
+    SOURCEPACKAGE_SET_KIND,
+    PREFACE_SET_KIND,
+    ANCDATADESCRIPTOR_SET_KIND,
+    VBIDATADESCRIPTOR_SET_KIND,
+    DMSET_SET_KIND,
+    TEXTBASEDOBJECT_SET_KIND,
+    TEXTBASEDDMFRAMEWORK_SET_KIND,
+    GENERICSTREAMTEXTBASEDSET_SET_KIND,
+    UTF8TEXTBASEDSET_SET_KIND,
+    UTF16TEXTBASEDSET_SET_KIND,
+    AVCSUBDESCRIPTOR_SET_KIND,
+    MCALABELSUBDESCRIPTOR_SET_KIND,
+    AUDIOCHANNELLABELSUBDESCRIPTOR_SET_KIND,
+    SOUNDFIELDGROUPLABELSUBDESCRIPTOR_SET_KIND,
+    GROUPOFSOUNDFIELDGROUPSLABELSUBDESCRIPTOR_SET_KIND,
+    VC2SUBDESCRIPTOR_SET_KIND,
+    DCTIMEDTEXTDESCRIPTOR_SET_KIND,
+    DCTIMEDTEXTRESOURCESUBDESCRIPTOR_SET_KIND,
+
+    NUM_SET_KINDS
+};
+
+
+};
+
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2008, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libMXF++/MXF.h>
+
+
+using namespace std;
+using namespace mxfpp;
+
+
+
+void MetadataSetVisitor::dispatch(MetadataSet *set)
+{
+    switch (set->getSetKind())
+    {
+        case INTERCHANGEOBJECT_SET_KIND:
+            visit(static_cast<InterchangeObject*>(set));
+            break;
+        case SEQUENCE_SET_KIND:
+            visit(static_cast<Sequence*>(set));
+            break;
+        case GENERICTRACK_SET_KIND:
+            visit(static_cast<GenericTrack*>(set));
+            break;
+        case GENERICPACKAGE_SET_KIND:
+            visit(static_cast<GenericPackage*>(set));
+            break;
+        case IDENTIFICATION_SET_KIND:
+            visit(static_cast<Identification*>(set));
+            break;
+        case ESSENCECONTAINERDATA_SET_KIND:
+            visit(static_cast<EssenceContainerData*>(set));
+            break;
+        case CONTENTSTORAGE_SET_KIND:
+            visit(static_cast<ContentStorage*>(set));
+            break;
+        case LOCATOR_SET_KIND:
+            visit(static_cast<Locator*>(set));
+            break;
+        case NETWORKLOCATOR_SET_KIND:
+            visit(static_cast<NetworkLocator*>(set));
+            break;
+        case TEXTLOCATOR_SET_KIND:
+            visit(static_cast<TextLocator*>(set));
+            break;
+        case STATICTRACK_SET_KIND:
+            visit(static_cast<StaticTrack*>(set));
+            break;
+        case TRACK_SET_KIND:
+            visit(static_cast<Track*>(set));
+            break;
+        case EVENTTRACK_SET_KIND:
+            visit(static_cast<EventTrack*>(set));
+            break;
+        case STRUCTURALCOMPONENT_SET_KIND:
+            visit(static_cast<StructuralComponent*>(set));
+            break;
+        case TIMECODECOMPONENT_SET_KIND:
+            visit(static_cast<TimecodeComponent*>(set));
+            break;
+        case SOURCECLIP_SET_KIND:
+            visit(static_cast<SourceClip*>(set));
+            break;
+        case DMFRAMEWORK_SET_KIND:
+            visit(static_cast<DMFramework*>(set));
+            break;
+        case DMSEGMENT_SET_KIND:
+            visit(static_cast<DMSegment*>(set));
+            break;
+        case DMSOURCECLIP_SET_KIND:
+            visit(static_cast<DMSourceClip*>(set));
+            break;
+        case SUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<SubDescriptor*>(set));
+            break;
+        case GENERICDESCRIPTOR_SET_KIND:
+            visit(static_cast<GenericDescriptor*>(set));
+            break;
+        case FILEDESCRIPTOR_SET_KIND:
+            visit(static_cast<FileDescriptor*>(set));
+            break;
+        case GENERICPICTUREESSENCEDESCRIPTOR_SET_KIND:
+            visit(static_cast<GenericPictureEssenceDescriptor*>(set));
+            break;
+        case CDCIESSENCEDESCRIPTOR_SET_KIND:
+            visit(static_cast<CDCIEssenceDescriptor*>(set));
+            break;
+        case MPEGVIDEODESCRIPTOR_SET_KIND:
+            visit(static_cast<MPEGVideoDescriptor*>(set));
+            break;
+        case RGBAESSENCEDESCRIPTOR_SET_KIND:
+            visit(static_cast<RGBAEssenceDescriptor*>(set));
+            break;
+        case GENERICSOUNDESSENCEDESCRIPTOR_SET_KIND:
+            visit(static_cast<GenericSoundEssenceDescriptor*>(set));
+            break;
+        case GENERICDATAESSENCEDESCRIPTOR_SET_KIND:
+            visit(static_cast<GenericDataEssenceDescriptor*>(set));
+            break;
+        case MULTIPLEDESCRIPTOR_SET_KIND:
+            visit(static_cast<MultipleDescriptor*>(set));
+            break;
+        case WAVEAUDIODESCRIPTOR_SET_KIND:
+            visit(static_cast<WaveAudioDescriptor*>(set));
+            break;
+        case AES3AUDIODESCRIPTOR_SET_KIND:
+            visit(static_cast<AES3AudioDescriptor*>(set));
+            break;
+        case MATERIALPACKAGE_SET_KIND:
+            visit(static_cast<MaterialPackage*>(set));
+            break;
+        case SOURCEPACKAGE_SET_KIND:
+            visit(static_cast<SourcePackage*>(set));
+            break;
+        case PREFACE_SET_KIND:
+            visit(static_cast<Preface*>(set));
+            break;
+        case ANCDATADESCRIPTOR_SET_KIND:
+            visit(static_cast<ANCDataDescriptor*>(set));
+            break;
+        case VBIDATADESCRIPTOR_SET_KIND:
+            visit(static_cast<VBIDataDescriptor*>(set));
+            break;
+        case DMSET_SET_KIND:
+            visit(static_cast<DMSet*>(set));
+            break;
+        case TEXTBASEDOBJECT_SET_KIND:
+            visit(static_cast<TextBasedObject*>(set));
+            break;
+        case TEXTBASEDDMFRAMEWORK_SET_KIND:
+            visit(static_cast<TextBasedDMFramework*>(set));
+            break;
+        case GENERICSTREAMTEXTBASEDSET_SET_KIND:
+            visit(static_cast<GenericStreamTextBasedSet*>(set));
+            break;
+        case UTF8TEXTBASEDSET_SET_KIND:
+            visit(static_cast<UTF8TextBasedSet*>(set));
+            break;
+        case UTF16TEXTBASEDSET_SET_KIND:
+            visit(static_cast<UTF16TextBasedSet*>(set));
+            break;
+        case AVCSUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<AVCSubDescriptor*>(set));
+            break;
+        case MCALABELSUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<MCALabelSubDescriptor*>(set));
+            break;
+        case AUDIOCHANNELLABELSUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<AudioChannelLabelSubDescriptor*>(set));
+            break;
+        case SOUNDFIELDGROUPLABELSUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<SoundfieldGroupLabelSubDescriptor*>(set));
+            break;
+        case GROUPOFSOUNDFIELDGROUPSLABELSUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<GroupOfSoundfieldGroupsLabelSubDescriptor*>(set));
+            break;
+        case VC2SUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<VC2SubDescriptor*>(set));
+            break;
+        case DCTIMEDTEXTDESCRIPTOR_SET_KIND:
+            visit(static_cast<DCTimedTextDescriptor*>(set));
+            break;
+        case DCTIMEDTEXTRESOURCESUBDESCRIPTOR_SET_KIND:
+            visit(static_cast<DCTimedTextResourceSubDescriptor*>(set));
+            break;
+        default:
+            visit(set);
+            break;
+    }
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2008, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Author: Philip de Nier
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXFPP_METADATA_SET_VISITOR_H_
+#define MXFPP_METADATA_SET_VISITOR_H_
+
+
+
+#include <libMXF++/metadata/Metadata.h>
+
+
+namespace mxfpp
+{
+
+
+// dispatch() calls the visit function for the set's kind. The default visit functions call the visit
+// function for the parent class
+
+class MetadataSetVisitor
+{
+public:
+    virtual ~MetadataSetVisitor() {}
+
+    void dispatch(MetadataSet *set);
+
+    virtual void visit(MetadataSet *set) { (void)set; }
+    virtual void visit(InterchangeObject *set) { visit(static_cast<MetadataSet*>(set)); }
+    virtual void visit(Sequence *set) { visit(static_cast<StructuralComponent*>(set)); }
+    virtual void visit(GenericTrack *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(GenericPackage *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(Identification *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(EssenceContainerData *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(ContentStorage *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(Locator *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(NetworkLocator *set) { visit(static_cast<Locator*>(set)); }
+    virtual void visit(TextLocator *set) { visit(static_cast<Locator*>(set)); }
+    virtual void visit(StaticTrack *set) { visit(static_cast<GenericTrack*>(set)); }
+    virtual void visit(Track *set) { visit(static_cast<GenericTrack*>(set)); }
+    virtual void visit(EventTrack *set) { visit(static_cast<GenericTrack*>(set)); }
+    virtual void visit(StructuralComponent *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(TimecodeComponent *set) { visit(static_cast<StructuralComponent*>(set)); }
+    virtual void visit(SourceClip *set) { visit(static_cast<StructuralComponent*>(set)); }
+    virtual void visit(DMFramework *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(DMSegment *set) { visit(static_cast<StructuralComponent*>(set)); }
+    virtual void visit(DMSourceClip *set) { visit(static_cast<SourceClip*>(set)); }
+    virtual void visit(SubDescriptor *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(GenericDescriptor *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(FileDescriptor *set) { visit(static_cast<GenericDescriptor*>(set)); }
+    virtual void visit(GenericPictureEssenceDescriptor *set) { visit(static_cast<FileDescriptor*>(set)); }
+    virtual void visit(CDCIEssenceDescriptor *set) { visit(static_cast<GenericPictureEssenceDescriptor*>(set)); }
+    virtual void visit(MPEGVideoDescriptor *set) { visit(static_cast<CDCIEssenceDescriptor*>(set)); }
+    virtual void visit(RGBAEssenceDescriptor *set) { visit(static_cast<GenericPictureEssenceDescriptor*>(set)); }
+    virtual void visit(GenericSoundEssenceDescriptor *set) { visit(static_cast<FileDescriptor*>(set)); }
+    virtual void visit(GenericDataEssenceDescriptor *set) { visit(static_cast<FileDescriptor*>(set)); }
+    virtual void visit(MultipleDescriptor *set) { visit(static_cast<FileDescriptor*>(set)); }
+    virtual void visit(WaveAudioDescriptor *set) { visit(static_cast<GenericSoundEssenceDescriptor*>(set)); }
+    virtual void visit(AES3AudioDescriptor *set) { visit(static_cast<WaveAudioDescriptor*>(set)); }
+    virtual void visit(MaterialPackage *set) { visit(static_cast<GenericPackage*>(set)); }
+    virtual void visit(SourcePackage *set) { visit(static_cast<GenericPackage*>(set)); }
+    virtual void visit(Preface *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(ANCDataDescriptor *set) { visit(static_cast<GenericDataEssenceDescriptor*>(set)); }
+    virtual void visit(VBIDataDescriptor *set) { visit(static_cast<GenericDataEssenceDescriptor*>(set)); }
+    virtual void visit(DMSet *set) { visit(static_cast<InterchangeObject*>(set)); }
+    virtual void visit(TextBasedObject *set) { visit(static_cast<DMSet*>(set)); }
+    virtual void visit(TextBasedDMFramework *set) { visit(static_cast<DMFramework*>(set)); }
+    virtual void visit(GenericStreamTextBasedSet *set) { visit(static_cast<TextBasedObject*>(set)); }
+    virtual void visit(UTF8TextBasedSet *set) { visit(static_cast<TextBasedObject*>(set)); }
+    virtual void visit(UTF16TextBasedSet *set) { visit(static_cast<TextBasedObject*>(set)); }
+    virtual void visit(AVCSubDescriptor *set) { visit(static_cast<SubDescriptor*>(set)); }
+    virtual void visit(MCALabelSubDescriptor *set) { visit(static_cast<SubDescriptor*>(set)); }
+    virtual void visit(AudioChannelLabelSubDescriptor *set) { visit(static_cast<MCALabelSubDescriptor*>(set)); }
+    virtual void visit(SoundfieldGroupLabelSubDescriptor *set) { visit(static_cast<MCALabelSubDescriptor*>(set)); }
+    virtual void visit(GroupOfSoundfieldGroupsLabelSubDescriptor *set) { visit(static_cast<MCALabelSubDescriptor*>(set)); }
+    virtual void visit(VC2SubDescriptor *set) { visit(static_cast<SubDescriptor*>(set)); }
+    virtual void visit(DCTimedTextDescriptor *set) { visit(static_cast<GenericDataEssenceDescriptor*>(set)); }
+    virtual void visit(DCTimedTextResourceSubDescriptor *set) { visit(static_cast<SubDescriptor*>(set)); }
+};
+
+
+};
+
+
+#endif
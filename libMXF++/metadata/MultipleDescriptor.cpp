@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 MultipleDescriptor::MultipleDescriptor(HeaderMetadata *headerMetadata)
 : MultipleDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(MULTIPLEDESCRIPTOR_SET_KIND);
+}
 
 MultipleDescriptor::MultipleDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : MultipleDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(MULTIPLEDESCRIPTOR_SET_KIND);
+}
 
 MultipleDescriptor::~MultipleDescriptor()
 {}
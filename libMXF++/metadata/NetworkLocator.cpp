@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 NetworkLocator::NetworkLocator(HeaderMetadata *headerMetadata)
 : NetworkLocatorBase(headerMetadata)
-{}
+{
+    setSetKind(NETWORKLOCATOR_SET_KIND);
+}
 
 NetworkLocator::NetworkLocator(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : NetworkLocatorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(NETWORKLOCATOR_SET_KIND);
+}
 
 NetworkLocator::~NetworkLocator()
 {}
@@ -43,27 +43,22 @@ using namespace mxfpp;
 
 Preface::Preface(HeaderMetadata *headerMetadata)
 : PrefaceBase(headerMetadata)
-{}
+{
+    setSetKind(PREFACE_SET_KIND);
+}
 
 Preface::Preface(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : PrefaceBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(PREFACE_SET_KIND);
+}
 
 Preface::~Preface()
 {}
 
 GenericPackage* Preface::findPackage(mxfUMID package_uid) const
 {
-    vector<GenericPackage*> packages = getContentStorage()->getPackages();
-    mxfUMID uid;
-    size_t i;
-    for (i = 0; i < packages.size(); i++) {
-        uid = packages[i]->getPackageUID();
-        if (mxf_equals_umid(&package_uid, &uid))
-            return packages[i];
-    }
-
-    return 0;
+    return _headerMetadata->getPackageGraph()->findPackage(package_uid);
 }
 
 MaterialPackage* Preface::findMaterialPackage() const
@@ -72,7 +67,7 @@ MaterialPackage* Preface::findMaterialPackage() const
     MaterialPackage *material_package;
     size_t i;
     for (i = 0; i < packages.size(); i++) {
-        material_package = dynamic_cast<MaterialPackage*>(packages[i]);
+        material_package = metadata_set_cast<MaterialPackage>(packages[i]);
         if (material_package)
             return material_package;
     }
@@ -87,10 +82,10 @@ vector<SourcePackage*> Preface::findFileSourcePackages() const
     SourcePackage *file_package;
     size_t i;
     for (i = 0; i < packages.size(); i++) {
-        file_package = dynamic_cast<SourcePackage*>(packages[i]);
+        file_package = metadata_set_cast<SourcePackage>(packages[i]);
         if (!file_package ||
             !file_package->haveDescriptor() ||
-            !dynamic_cast<FileDescriptor*>(file_package->getDescriptorLight()))
+            !metadata_set_cast<FileDescriptor>(file_package->getDescriptorLight()))
         {
             continue;
         }
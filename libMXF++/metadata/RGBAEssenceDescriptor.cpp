@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 RGBAEssenceDescriptor::RGBAEssenceDescriptor(HeaderMetadata *headerMetadata)
 : RGBAEssenceDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(RGBAESSENCEDESCRIPTOR_SET_KIND);
+}
 
 RGBAEssenceDescriptor::RGBAEssenceDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : RGBAEssenceDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(RGBAESSENCEDESCRIPTOR_SET_KIND);
+}
 
 RGBAEssenceDescriptor::~RGBAEssenceDescriptor()
 {}
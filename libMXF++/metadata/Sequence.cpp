@@ -33,6 +33,8 @@
 #include "config.h"
 #endif
 
+#include <algorithm>
+
 #include <libMXF++/MXF.h>
 
 
@@ -43,13 +45,102 @@ using namespace mxfpp;
 
 Sequence::Sequence(HeaderMetadata *headerMetadata)
 : SequenceBase(headerMetadata)
-{}
+{
+    setSetKind(SEQUENCE_SET_KIND);
+    _indexValid = false;
+    _indexComplete = false;
+    _indexModificationCount = 0;
+}
 
 Sequence::Sequence(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : SequenceBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(SEQUENCE_SET_KIND);
+    _indexValid = false;
+    _indexComplete = false;
+    _indexModificationCount = 0;
+}
 
 Sequence::~Sequence()
 {}
 
+void Sequence::appendStructuralComponents(StructuralComponent *value)
+{
+    bool wasCurrent = haveCurrentComponentIndex();
+
+    SequenceBase::appendStructuralComponents(value);
+
+    // extend the index rather than rebuilding it if only the append has modified the metadata
+    if (wasCurrent) {
+        if (_indexComplete) {
+            if (value->haveDuration() && value->getDuration() >= 0) {
+                _indexComponents.push_back(value);
+                _indexStarts.push_back(_indexStarts.back() + value->getDuration());
+            } else {
+                _indexComplete = false;
+            }
+        }
+        _indexModificationCount = _headerMetadata->getModificationCount();
+    }
+}
+
+StructuralComponent* Sequence::findStructuralComponent(int64_t position, int64_t *offset, size_t *index)
+{
+    if (!haveCurrentComponentIndex())
+        updateComponentIndex();
+
+    if (position >= _indexStarts[_indexComponents.size()] && !_indexComplete) {
+        throw MXFException("Sequence position %" PRId64 " is after a component with an unknown duration",
+                           position);
+    }
+    if (position < 0 || _indexComponents.empty() || position >= _indexStarts[_indexComponents.size()])
+        return 0;
+
+    // find the last component start <= position
+    size_t i = upper_bound(_indexStarts.begin(), _indexStarts.begin() + _indexComponents.size() + 1, position) -
+                   _indexStarts.begin() - 1;
+
+    if (offset)
+        *offset = position - _indexStarts[i];
+    if (index)
+        *index = i;
+    return _indexComponents[i];
+}
+
+int64_t Sequence::getStructuralComponentsDuration()
+{
+    if (!haveCurrentComponentIndex())
+        updateComponentIndex();
+
+    if (!_indexComplete)
+        return -1;
+    return _indexStarts[_indexComponents.size()];
+}
+
+bool Sequence::haveCurrentComponentIndex() const
+{
+    return _indexValid && _indexModificationCount == _headerMetadata->getModificationCount();
+}
+
+void Sequence::updateComponentIndex()
+{
+    _indexComponents = getStructuralComponents();
+    _indexStarts.resize(_indexComponents.size() + 1);
+
+    // the index stops at the first component with an unknown duration
+    _indexStarts[0] = 0;
+    size_t i;
+    for (i = 0; i < _indexComponents.size(); i++) {
+        if (!_indexComponents[i]->haveDuration() || _indexComponents[i]->getDuration() < 0)
+            break;
+        _indexStarts[i + 1] = _indexStarts[i] + _indexComponents[i]->getDuration();
+    }
+    _indexComplete = (i == _indexComponents.size());
+    _indexComponents.resize(i);
+    _indexStarts.resize(i + 1);
+
+    _indexValid = true;
+    _indexModificationCount = _headerMetadata->getModificationCount();
+}
+
 
@@ -50,11 +50,28 @@ public:
     Sequence(HeaderMetadata *headerMetadata);
     virtual ~Sequence();
 
+    void appendStructuralComponents(StructuralComponent *value);
 
-
+    // returns the component covering the edit unit position and the position's offset into the component,
+    // or 0 if the position is outside the sequence. The cumulative durations are cached until the metadata
+    // is modified. Throws an exception if the position is after a component with an unknown or negative
+    // duration
+    StructuralComponent* findStructuralComponent(int64_t position, int64_t *offset, size_t *index = 0);
+    // returns -1 if a component has an unknown or negative duration
+    int64_t getStructuralComponentsDuration();
 
 protected:
     Sequence(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
+
+private:
+    bool haveCurrentComponentIndex() const;
+    void updateComponentIndex();
+
+    std::vector<StructuralComponent*> _indexComponents;
+    std::vector<int64_t> _indexStarts;
+    bool _indexValid;
+    bool _indexComplete;
+    uint32_t _indexModificationCount;
 };
 
 
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 SoundfieldGroupLabelSubDescriptor::SoundfieldGroupLabelSubDescriptor(HeaderMetadata *headerMetadata)
 : SoundfieldGroupLabelSubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(SOUNDFIELDGROUPLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 SoundfieldGroupLabelSubDescriptor::SoundfieldGroupLabelSubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : SoundfieldGroupLabelSubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(SOUNDFIELDGROUPLABELSUBDESCRIPTOR_SET_KIND);
+}
 
 SoundfieldGroupLabelSubDescriptor::~SoundfieldGroupLabelSubDescriptor()
 {}
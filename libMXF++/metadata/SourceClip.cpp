@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 SourceClip::SourceClip(HeaderMetadata *headerMetadata)
 : SourceClipBase(headerMetadata)
-{}
+{
+    setSetKind(SOURCECLIP_SET_KIND);
+}
 
 SourceClip::SourceClip(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : SourceClipBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(SOURCECLIP_SET_KIND);
+}
 
 SourceClip::~SourceClip()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 SourcePackage::SourcePackage(HeaderMetadata *headerMetadata)
 : SourcePackageBase(headerMetadata)
-{}
+{
+    setSetKind(SOURCEPACKAGE_SET_KIND);
+}
 
 SourcePackage::SourcePackage(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : SourcePackageBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(SOURCEPACKAGE_SET_KIND);
+}
 
 SourcePackage::~SourcePackage()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 StaticTrack::StaticTrack(HeaderMetadata *headerMetadata)
 : StaticTrackBase(headerMetadata)
-{}
+{
+    setSetKind(STATICTRACK_SET_KIND);
+}
 
 StaticTrack::StaticTrack(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : StaticTrackBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(STATICTRACK_SET_KIND);
+}
 
 StaticTrack::~StaticTrack()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 StructuralComponent::StructuralComponent(HeaderMetadata *headerMetadata)
 : StructuralComponentBase(headerMetadata)
-{}
+{
+    setSetKind(STRUCTURALCOMPONENT_SET_KIND);
+}
 
 StructuralComponent::StructuralComponent(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : StructuralComponentBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(STRUCTURALCOMPONENT_SET_KIND);
+}
 
 StructuralComponent::~StructuralComponent()
 {}
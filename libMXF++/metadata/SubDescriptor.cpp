@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 SubDescriptor::SubDescriptor(HeaderMetadata *headerMetadata)
 : SubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(SUBDESCRIPTOR_SET_KIND);
+}
 
 SubDescriptor::SubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : SubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(SUBDESCRIPTOR_SET_KIND);
+}
 
 SubDescriptor::~SubDescriptor()
 {}
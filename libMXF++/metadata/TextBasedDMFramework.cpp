@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 TextBasedDMFramework::TextBasedDMFramework(HeaderMetadata *headerMetadata)
 : TextBasedDMFrameworkBase(headerMetadata)
-{}
+{
+    setSetKind(TEXTBASEDDMFRAMEWORK_SET_KIND);
+}
 
 TextBasedDMFramework::TextBasedDMFramework(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : TextBasedDMFrameworkBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(TEXTBASEDDMFRAMEWORK_SET_KIND);
+}
 
 TextBasedDMFramework::~TextBasedDMFramework()
 {}
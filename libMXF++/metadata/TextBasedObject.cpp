@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 TextBasedObject::TextBasedObject(HeaderMetadata *headerMetadata)
 : TextBasedObjectBase(headerMetadata)
-{}
+{
+    setSetKind(TEXTBASEDOBJECT_SET_KIND);
+}
 
 TextBasedObject::TextBasedObject(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : TextBasedObjectBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(TEXTBASEDOBJECT_SET_KIND);
+}
 
 TextBasedObject::~TextBasedObject()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 TextLocator::TextLocator(HeaderMetadata *headerMetadata)
 : TextLocatorBase(headerMetadata)
-{}
+{
+    setSetKind(TEXTLOCATOR_SET_KIND);
+}
 
 TextLocator::TextLocator(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : TextLocatorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(TEXTLOCATOR_SET_KIND);
+}
 
 TextLocator::~TextLocator()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 TimecodeComponent::TimecodeComponent(HeaderMetadata *headerMetadata)
 : TimecodeComponentBase(headerMetadata)
-{}
+{
+    setSetKind(TIMECODECOMPONENT_SET_KIND);
+}
 
 TimecodeComponent::TimecodeComponent(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : TimecodeComponentBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(TIMECODECOMPONENT_SET_KIND);
+}
 
 TimecodeComponent::~TimecodeComponent()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 Track::Track(HeaderMetadata *headerMetadata)
 : TrackBase(headerMetadata)
-{}
+{
+    setSetKind(TRACK_SET_KIND);
+}
 
 Track::Track(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : TrackBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(TRACK_SET_KIND);
+}
 
 Track::~Track()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 UTF16TextBasedSet::UTF16TextBasedSet(HeaderMetadata *headerMetadata)
 : UTF16TextBasedSetBase(headerMetadata)
-{}
+{
+    setSetKind(UTF16TEXTBASEDSET_SET_KIND);
+}
 
 UTF16TextBasedSet::UTF16TextBasedSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : UTF16TextBasedSetBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(UTF16TEXTBASEDSET_SET_KIND);
+}
 
 UTF16TextBasedSet::~UTF16TextBasedSet()
 {}
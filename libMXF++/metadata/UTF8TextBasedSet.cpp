@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 UTF8TextBasedSet::UTF8TextBasedSet(HeaderMetadata *headerMetadata)
 : UTF8TextBasedSetBase(headerMetadata)
-{}
+{
+    setSetKind(UTF8TEXTBASEDSET_SET_KIND);
+}
 
 UTF8TextBasedSet::UTF8TextBasedSet(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : UTF8TextBasedSetBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(UTF8TEXTBASEDSET_SET_KIND);
+}
 
 UTF8TextBasedSet::~UTF8TextBasedSet()
 {}
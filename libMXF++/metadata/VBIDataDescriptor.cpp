@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 VBIDataDescriptor::VBIDataDescriptor(HeaderMetadata *headerMetadata)
 : VBIDataDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(VBIDATADESCRIPTOR_SET_KIND);
+}
 
 VBIDataDescriptor::VBIDataDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : VBIDataDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(VBIDATADESCRIPTOR_SET_KIND);
+}
 
 VBIDataDescriptor::~VBIDataDescriptor()
 {}
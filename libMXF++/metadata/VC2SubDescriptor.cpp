@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 VC2SubDescriptor::VC2SubDescriptor(HeaderMetadata *headerMetadata)
 : VC2SubDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(VC2SUBDESCRIPTOR_SET_KIND);
+}
 
 VC2SubDescriptor::VC2SubDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : VC2SubDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(VC2SUBDESCRIPTOR_SET_KIND);
+}
 
 VC2SubDescriptor::~VC2SubDescriptor()
 {}
@@ -43,11 +43,15 @@ using namespace mxfpp;
 
 WaveAudioDescriptor::WaveAudioDescriptor(HeaderMetadata *headerMetadata)
 : WaveAudioDescriptorBase(headerMetadata)
-{}
+{
+    setSetKind(WAVEAUDIODESCRIPTOR_SET_KIND);
+}
 
 WaveAudioDescriptor::WaveAudioDescriptor(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)
 : WaveAudioDescriptorBase(headerMetadata, cMetadataSet)
-{}
+{
+    setSetKind(WAVEAUDIODESCRIPTOR_SET_KIND);
+}
 
 WaveAudioDescriptor::~WaveAudioDescriptor()
 {}
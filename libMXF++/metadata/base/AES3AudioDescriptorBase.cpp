@@ -232,6 +232,7 @@ vector<mxfAES3FixedData> AES3AudioDescriptorBase::getAES3FixedDataArrayItem(cons
 
 void AES3AudioDescriptorBase::setAES3FixedArrayItem(const mxfKey *itemKey, const vector<mxfAES3FixedData> &value)
 {
+    markModified();
     uint32_t arraySize = (uint32_t)value.size();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_alloc_array_item_elements(_cMetadataSet, itemKey, mxfAES3FixedData_extlen, arraySize, &data));
@@ -245,6 +246,7 @@ void AES3AudioDescriptorBase::setAES3FixedArrayItem(const mxfKey *itemKey, const
 
 void AES3AudioDescriptorBase::appendAES3FixedArrayItem(const mxfKey *itemKey, const mxfAES3FixedData &value)
 {
+    markModified();
     uint8_t *data = 0;
     MXFPP_CHECK(mxf_grow_array_item(_cMetadataSet, itemKey, mxfAES3FixedData_extlen, 1, &data));
     mxf_set_aes3_fixed_data(&value, data);
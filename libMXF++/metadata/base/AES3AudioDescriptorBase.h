@@ -46,6 +46,7 @@ class AES3AudioDescriptorBase : public WaveAudioDescriptor
 public:
     friend class MetadataSetFactory<AES3AudioDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = AES3AUDIODESCRIPTOR_SET_KIND;
 
 public:
     AES3AudioDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class ANCDataDescriptorBase : public GenericDataEssenceDescriptor
 public:
     friend class MetadataSetFactory<ANCDataDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = ANCDATADESCRIPTOR_SET_KIND;
 
 public:
     ANCDataDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class AVCSubDescriptorBase : public SubDescriptor
 public:
     friend class MetadataSetFactory<AVCSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = AVCSUBDESCRIPTOR_SET_KIND;
 
 public:
     AVCSubDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class AudioChannelLabelSubDescriptorBase : public MCALabelSubDescriptor
 public:
     friend class MetadataSetFactory<AudioChannelLabelSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = AUDIOCHANNELLABELSUBDESCRIPTOR_SET_KIND;
 
 public:
     AudioChannelLabelSubDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class CDCIEssenceDescriptorBase : public GenericPictureEssenceDescriptor
 public:
     friend class MetadataSetFactory<CDCIEssenceDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = CDCIESSENCEDESCRIPTOR_SET_KIND;
 
 public:
     CDCIEssenceDescriptorBase(HeaderMetadata *headerMetadata);
@@ -90,6 +91,30 @@ public:
    void setColorRange(uint32_t value);
 
 
+   // item descriptors
+
+   struct ComponentDepthItem : ItemDescriptor<uint32_t, 0x3301>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, ComponentDepth); } };
+   struct HorizontalSubsamplingItem : ItemDescriptor<uint32_t, 0x3302>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, HorizontalSubsampling); } };
+   struct VerticalSubsamplingItem : ItemDescriptor<uint32_t, 0x3308>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, VerticalSubsampling); } };
+   struct ColorSitingItem : ItemDescriptor<uint8_t, 0x3303>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, ColorSiting); } };
+   struct ReversedByteOrderItem : ItemDescriptor<bool, 0x330b>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, ReversedByteOrder); } };
+   struct PaddingBitsItem : ItemDescriptor<int16_t, 0x3307>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, PaddingBits); } };
+   struct AlphaSampleDepthItem : ItemDescriptor<uint32_t, 0x3309>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, AlphaSampleDepth); } };
+   struct BlackRefLevelItem : ItemDescriptor<uint32_t, 0x3304>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, BlackRefLevel); } };
+   struct WhiteReflevelItem : ItemDescriptor<uint32_t, 0x3305>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, WhiteReflevel); } };
+   struct ColorRangeItem : ItemDescriptor<uint32_t, 0x3306>
+   { static const mxfKey* key() { return &MXF_ITEM_K(CDCIEssenceDescriptor, ColorRange); } };
+
+
 protected:
     CDCIEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -61,14 +61,7 @@ ContentStorageBase::~ContentStorageBase()
 
 std::vector<GenericPackage*> ContentStorageBase::getPackages() const
 {
-    vector<GenericPackage*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(ContentStorage, Packages)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<GenericPackage*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<GenericPackage*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<GenericPackage>(&MXF_ITEM_K(ContentStorage, Packages));
 }
 
 bool ContentStorageBase::haveEssenceContainerData() const
@@ -78,14 +71,7 @@ bool ContentStorageBase::haveEssenceContainerData() const
 
 std::vector<EssenceContainerData*> ContentStorageBase::getEssenceContainerData() const
 {
-    vector<EssenceContainerData*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(ContentStorage, EssenceContainerData)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<EssenceContainerData*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<EssenceContainerData*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<EssenceContainerData>(&MXF_ITEM_K(ContentStorage, EssenceContainerData));
 }
 
 void ContentStorageBase::setPackages(const std::vector<GenericPackage*> &value)
@@ -46,6 +46,7 @@ class ContentStorageBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<ContentStorageBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = CONTENTSTORAGE_SET_KIND;
 
 public:
     ContentStorageBase(HeaderMetadata *headerMetadata);
@@ -44,6 +44,7 @@ class DCTimedTextDescriptorBase : public GenericDataEssenceDescriptor
 public:
     friend class MetadataSetFactory<DCTimedTextDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DCTIMEDTEXTDESCRIPTOR_SET_KIND;
 
 public:
     DCTimedTextDescriptorBase(HeaderMetadata *headerMetadata);
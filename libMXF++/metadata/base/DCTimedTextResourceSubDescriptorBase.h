@@ -44,6 +44,7 @@ class DCTimedTextResourceSubDescriptorBase : public SubDescriptor
 public:
     friend class MetadataSetFactory<DCTimedTextResourceSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DCTIMEDTEXTRESOURCESUBDESCRIPTOR_SET_KIND;
 
 public:
     DCTimedTextResourceSubDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class DMFrameworkBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<DMFrameworkBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DMFRAMEWORK_SET_KIND;
 
 public:
     DMFrameworkBase(HeaderMetadata *headerMetadata);
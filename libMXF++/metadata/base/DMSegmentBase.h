@@ -46,6 +46,7 @@ class DMSegmentBase : public StructuralComponent
 public:
     friend class MetadataSetFactory<DMSegmentBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DMSEGMENT_SET_KIND;
 
 public:
     DMSegmentBase(HeaderMetadata *headerMetadata);
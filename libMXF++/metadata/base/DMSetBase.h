@@ -46,6 +46,7 @@ class DMSetBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<DMSetBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DMSET_SET_KIND;
 
 public:
     DMSetBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class DMSourceClipBase : public SourceClip
 public:
     friend class MetadataSetFactory<DMSourceClipBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = DMSOURCECLIP_SET_KIND;
 
 public:
     DMSourceClipBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class EssenceContainerDataBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<EssenceContainerDataBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = ESSENCECONTAINERDATA_SET_KIND;
 
 public:
     EssenceContainerDataBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class EventTrackBase : public GenericTrack
 public:
     friend class MetadataSetFactory<EventTrackBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = EVENTTRACK_SET_KIND;
 
 public:
     EventTrackBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class FileDescriptorBase : public GenericDescriptor
 public:
     friend class MetadataSetFactory<FileDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = FILEDESCRIPTOR_SET_KIND;
 
 public:
     FileDescriptorBase(HeaderMetadata *headerMetadata);
@@ -73,6 +74,20 @@ public:
    void setCodec(mxfUL value);
 
 
+   // item descriptors
+
+   struct LinkedTrackIDItem : ItemDescriptor<uint32_t, 0x3006>
+   { static const mxfKey* key() { return &MXF_ITEM_K(FileDescriptor, LinkedTrackID); } };
+   struct SampleRateItem : ItemDescriptor<mxfRational, 0x3001>
+   { static const mxfKey* key() { return &MXF_ITEM_K(FileDescriptor, SampleRate); } };
+   struct ContainerDurationItem : ItemDescriptor<int64_t, 0x3002>
+   { static const mxfKey* key() { return &MXF_ITEM_K(FileDescriptor, ContainerDuration); } };
+   struct EssenceContainerItem : ItemDescriptor<mxfUL, 0x3004>
+   { static const mxfKey* key() { return &MXF_ITEM_K(FileDescriptor, EssenceContainer); } };
+   struct CodecItem : ItemDescriptor<mxfUL, 0x3005>
+   { static const mxfKey* key() { return &MXF_ITEM_K(FileDescriptor, Codec); } };
+
+
 protected:
     FileDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class GenericDataEssenceDescriptorBase : public FileDescriptor
 public:
     friend class MetadataSetFactory<GenericDataEssenceDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICDATAESSENCEDESCRIPTOR_SET_KIND;
 
 public:
     GenericDataEssenceDescriptorBase(HeaderMetadata *headerMetadata);
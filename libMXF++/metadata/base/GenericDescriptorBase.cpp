@@ -66,14 +66,7 @@ bool GenericDescriptorBase::haveLocators() const
 
 std::vector<Locator*> GenericDescriptorBase::getLocators() const
 {
-    vector<Locator*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(GenericDescriptor, Locators)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<Locator*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<Locator*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<Locator>(&MXF_ITEM_K(GenericDescriptor, Locators));
 }
 
 bool GenericDescriptorBase::haveSubDescriptors() const
@@ -83,14 +76,7 @@ bool GenericDescriptorBase::haveSubDescriptors() const
 
 std::vector<SubDescriptor*> GenericDescriptorBase::getSubDescriptors() const
 {
-    vector<SubDescriptor*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(GenericDescriptor, SubDescriptors)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<SubDescriptor*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<SubDescriptor*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<SubDescriptor>(&MXF_ITEM_K(GenericDescriptor, SubDescriptors));
 }
 
 void GenericDescriptorBase::setLocators(const std::vector<Locator*> &value)
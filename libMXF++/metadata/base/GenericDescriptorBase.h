@@ -46,6 +46,7 @@ class GenericDescriptorBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<GenericDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICDESCRIPTOR_SET_KIND;
 
 public:
     GenericDescriptorBase(HeaderMetadata *headerMetadata);
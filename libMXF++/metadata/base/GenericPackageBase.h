@@ -46,6 +46,7 @@ class GenericPackageBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<GenericPackageBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICPACKAGE_SET_KIND;
 
 public:
     GenericPackageBase(HeaderMetadata *headerMetadata);
@@ -72,6 +73,16 @@ public:
    void appendTracks(GenericTrack *value);
 
 
+   // item descriptors
+
+   struct PackageUIDItem : ItemDescriptor<mxfUMID, 0x4401>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPackage, PackageUID); } };
+   struct PackageCreationDateItem : ItemDescriptor<mxfTimestamp, 0x4405>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPackage, PackageCreationDate); } };
+   struct PackageModifiedDateItem : ItemDescriptor<mxfTimestamp, 0x4404>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPackage, PackageModifiedDate); } };
+
+
 protected:
     GenericPackageBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
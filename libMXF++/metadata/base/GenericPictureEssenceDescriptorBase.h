@@ -46,6 +46,7 @@ class GenericPictureEssenceDescriptorBase : public FileDescriptor
 public:
     friend class MetadataSetFactory<GenericPictureEssenceDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICPICTUREESSENCEDESCRIPTOR_SET_KIND;
 
 public:
     GenericPictureEssenceDescriptorBase(HeaderMetadata *headerMetadata);
@@ -139,6 +140,60 @@ public:
    void setColorPrimaries(mxfUL value);
 
 
+   // item descriptors
+
+   struct SignalStandardItem : ItemDescriptor<uint8_t, 0x3215>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, SignalStandard); } };
+   struct FrameLayoutItem : ItemDescriptor<uint8_t, 0x320c>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, FrameLayout); } };
+   struct StoredWidthItem : ItemDescriptor<uint32_t, 0x3203>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredWidth); } };
+   struct StoredHeightItem : ItemDescriptor<uint32_t, 0x3202>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredHeight); } };
+   struct StoredF2OffsetItem : ItemDescriptor<int32_t, 0x3216>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, StoredF2Offset); } };
+   struct SampledWidthItem : ItemDescriptor<uint32_t, 0x3205>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledWidth); } };
+   struct SampledHeightItem : ItemDescriptor<uint32_t, 0x3204>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledHeight); } };
+   struct SampledXOffsetItem : ItemDescriptor<int32_t, 0x3206>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledXOffset); } };
+   struct SampledYOffsetItem : ItemDescriptor<int32_t, 0x3207>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, SampledYOffset); } };
+   struct DisplayHeightItem : ItemDescriptor<uint32_t, 0x3208>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayHeight); } };
+   struct DisplayWidthItem : ItemDescriptor<uint32_t, 0x3209>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayWidth); } };
+   struct DisplayXOffsetItem : ItemDescriptor<int32_t, 0x320a>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayXOffset); } };
+   struct DisplayYOffsetItem : ItemDescriptor<int32_t, 0x320b>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayYOffset); } };
+   struct DisplayF2OffsetItem : ItemDescriptor<int32_t, 0x3217>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, DisplayF2Offset); } };
+   struct AspectRatioItem : ItemDescriptor<mxfRational, 0x320e>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, AspectRatio); } };
+   struct ActiveFormatDescriptorItem : ItemDescriptor<uint8_t, 0x3218>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, ActiveFormatDescriptor); } };
+   struct AlphaTransparencyItem : ItemDescriptor<uint8_t, 0x320f>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, AlphaTransparency); } };
+   struct CaptureGammaItem : ItemDescriptor<mxfUL, 0x3210>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, CaptureGamma); } };
+   struct ImageAlignmentOffsetItem : ItemDescriptor<uint32_t, 0x3211>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageAlignmentOffset); } };
+   struct ImageStartOffsetItem : ItemDescriptor<uint32_t, 0x3213>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageStartOffset); } };
+   struct ImageEndOffsetItem : ItemDescriptor<uint32_t, 0x3214>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, ImageEndOffset); } };
+   struct FieldDominanceItem : ItemDescriptor<uint8_t, 0x3212>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, FieldDominance); } };
+   struct PictureEssenceCodingItem : ItemDescriptor<mxfUL, 0x3201>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, PictureEssenceCoding); } };
+   struct CodingEquationsItem : ItemDescriptor<mxfUL, 0x321a>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, CodingEquations); } };
+   struct ColorPrimariesItem : ItemDescriptor<mxfUL, 0x3219>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericPictureEssenceDescriptor, ColorPrimaries); } };
+
+
 protected:
     GenericPictureEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class GenericSoundEssenceDescriptorBase : public FileDescriptor
 public:
     friend class MetadataSetFactory<GenericSoundEssenceDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICSOUNDESSENCEDESCRIPTOR_SET_KIND;
 
 public:
     GenericSoundEssenceDescriptorBase(HeaderMetadata *headerMetadata);
@@ -84,6 +85,26 @@ public:
    void setSoundEssenceCompression(mxfUL value);
 
 
+   // item descriptors
+
+   struct AudioSamplingRateItem : ItemDescriptor<mxfRational, 0x3d03>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioSamplingRate); } };
+   struct LockedItem : ItemDescriptor<bool, 0x3d02>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, Locked); } };
+   struct AudioRefLevelItem : ItemDescriptor<int8_t, 0x3d04>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, AudioRefLevel); } };
+   struct ElectroSpatialFormulationItem : ItemDescriptor<uint8_t, 0x3d05>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, ElectroSpatialFormulation); } };
+   struct ChannelCountItem : ItemDescriptor<uint32_t, 0x3d07>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, ChannelCount); } };
+   struct QuantizationBitsItem : ItemDescriptor<uint32_t, 0x3d01>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, QuantizationBits); } };
+   struct DialNormItem : ItemDescriptor<int8_t, 0x3d0c>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, DialNorm); } };
+   struct SoundEssenceCompressionItem : ItemDescriptor<mxfUL, 0x3d06>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericSoundEssenceDescriptor, SoundEssenceCompression); } };
+
+
 protected:
     GenericSoundEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
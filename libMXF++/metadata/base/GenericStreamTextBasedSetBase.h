@@ -46,6 +46,7 @@ class GenericStreamTextBasedSetBase : public TextBasedObject
 public:
     friend class MetadataSetFactory<GenericStreamTextBasedSetBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICSTREAMTEXTBASEDSET_SET_KIND;
 
 public:
     GenericStreamTextBasedSetBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class GenericTrackBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<GenericTrackBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GENERICTRACK_SET_KIND;
 
 public:
     GenericTrackBase(HeaderMetadata *headerMetadata);
@@ -70,6 +71,14 @@ public:
    void setSequence(StructuralComponent *value);
 
 
+   // item descriptors
+
+   struct TrackIDItem : ItemDescriptor<uint32_t, 0x4801>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericTrack, TrackID); } };
+   struct TrackNumberItem : ItemDescriptor<uint32_t, 0x4804>
+   { static const mxfKey* key() { return &MXF_ITEM_K(GenericTrack, TrackNumber); } };
+
+
 protected:
     GenericTrackBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class GroupOfSoundfieldGroupsLabelSubDescriptorBase : public MCALabelSubDescript
 public:
     friend class MetadataSetFactory<GroupOfSoundfieldGroupsLabelSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = GROUPOFSOUNDFIELDGROUPSLABELSUBDESCRIPTOR_SET_KIND;
 
 public:
     GroupOfSoundfieldGroupsLabelSubDescriptorBase(HeaderMetadata *headerMetadata);
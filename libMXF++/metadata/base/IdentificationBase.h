@@ -46,6 +46,7 @@ class IdentificationBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<IdentificationBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = IDENTIFICATION_SET_KIND;
 
 public:
     IdentificationBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class InterchangeObjectBase : public MetadataSet
 public:
     friend class MetadataSetFactory<InterchangeObjectBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = INTERCHANGEOBJECT_SET_KIND;
 
 public:
     InterchangeObjectBase(HeaderMetadata *headerMetadata);
@@ -65,6 +66,14 @@ public:
    void setGenerationUID(mxfUUID value);
 
 
+   // item descriptors
+
+   struct InstanceUIDItem : ItemDescriptor<mxfUUID, 0x3c0a>
+   { static const mxfKey* key() { return &MXF_ITEM_K(InterchangeObject, InstanceUID); } };
+   struct GenerationUIDItem : ItemDescriptor<mxfUUID, 0x0102>
+   { static const mxfKey* key() { return &MXF_ITEM_K(InterchangeObject, GenerationUID); } };
+
+
 protected:
     InterchangeObjectBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
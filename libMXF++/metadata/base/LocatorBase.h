@@ -46,6 +46,7 @@ class LocatorBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<LocatorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = LOCATOR_SET_KIND;
 
 public:
     LocatorBase(HeaderMetadata *headerMetadata);
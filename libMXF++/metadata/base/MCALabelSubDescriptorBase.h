@@ -46,6 +46,7 @@ class MCALabelSubDescriptorBase : public SubDescriptor
 public:
     friend class MetadataSetFactory<MCALabelSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = MCALABELSUBDESCRIPTOR_SET_KIND;
 
 public:
     MCALabelSubDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class MPEGVideoDescriptorBase : public CDCIEssenceDescriptor
 public:
     friend class MetadataSetFactory<MPEGVideoDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = MPEGVIDEODESCRIPTOR_SET_KIND;
 
 public:
     MPEGVideoDescriptorBase(HeaderMetadata *headerMetadata);
@@ -90,6 +91,30 @@ public:
    void setProfileAndLevel(uint8_t value);
 
 
+   // item descriptors
+
+   struct SingleSequenceItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, SingleSequence); } };
+   struct ConstantBFramesItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, ConstantBFrames); } };
+   struct CodedContentTypeItem : ItemDescriptor<uint8_t, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, CodedContentType); } };
+   struct LowDelayItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, LowDelay); } };
+   struct ClosedGOPItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, ClosedGOP); } };
+   struct IdenticalGOPItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, IdenticalGOP); } };
+   struct MaxGOPItem : ItemDescriptor<uint16_t, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, MaxGOP); } };
+   struct MaxBPictureCountItem : ItemDescriptor<uint16_t, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, MaxBPictureCount); } };
+   struct BitRateItem : ItemDescriptor<uint32_t, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, BitRate); } };
+   struct ProfileAndLevelItem : ItemDescriptor<uint8_t, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(MPEGVideoDescriptor, ProfileAndLevel); } };
+
+
 protected:
     MPEGVideoDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
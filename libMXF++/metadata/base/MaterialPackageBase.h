@@ -46,6 +46,7 @@ class MaterialPackageBase : public GenericPackage
 public:
     friend class MetadataSetFactory<MaterialPackageBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = MATERIALPACKAGE_SET_KIND;
 
 public:
     MaterialPackageBase(HeaderMetadata *headerMetadata);
@@ -61,14 +61,7 @@ MultipleDescriptorBase::~MultipleDescriptorBase()
 
 std::vector<GenericDescriptor*> MultipleDescriptorBase::getSubDescriptorUIDs() const
 {
-    vector<GenericDescriptor*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(MultipleDescriptor, SubDescriptorUIDs)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<GenericDescriptor*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<GenericDescriptor*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<GenericDescriptor>(&MXF_ITEM_K(MultipleDescriptor, SubDescriptorUIDs));
 }
 
 void MultipleDescriptorBase::setSubDescriptorUIDs(const std::vector<GenericDescriptor*> &value)
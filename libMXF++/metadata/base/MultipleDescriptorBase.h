@@ -46,6 +46,7 @@ class MultipleDescriptorBase : public FileDescriptor
 public:
     friend class MetadataSetFactory<MultipleDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = MULTIPLEDESCRIPTOR_SET_KIND;
 
 public:
     MultipleDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class NetworkLocatorBase : public Locator
 public:
     friend class MetadataSetFactory<NetworkLocatorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = NETWORKLOCATOR_SET_KIND;
 
 public:
     NetworkLocatorBase(HeaderMetadata *headerMetadata);
@@ -93,14 +93,7 @@ GenericPackage* PrefaceBase::getPrimaryPackage() const
 
 std::vector<Identification*> PrefaceBase::getIdentifications() const
 {
-    vector<Identification*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(Preface, Identifications)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<Identification*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<Identification*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<Identification>(&MXF_ITEM_K(Preface, Identifications));
 }
 
 ContentStorage* PrefaceBase::getContentStorage() const
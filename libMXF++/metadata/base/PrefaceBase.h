@@ -46,6 +46,7 @@ class PrefaceBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<PrefaceBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = PREFACE_SET_KIND;
 
 public:
     PrefaceBase(HeaderMetadata *headerMetadata);
@@ -86,6 +87,20 @@ public:
    void setIsRIPPresent(bool value);
 
 
+   // item descriptors
+
+   struct LastModifiedDateItem : ItemDescriptor<mxfTimestamp, 0x3b02>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Preface, LastModifiedDate); } };
+   struct VersionItem : ItemDescriptor<uint16_t, 0x3b05>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Preface, Version); } };
+   struct ObjectModelVersionItem : ItemDescriptor<uint32_t, 0x3b07>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Preface, ObjectModelVersion); } };
+   struct OperationalPatternItem : ItemDescriptor<mxfUL, 0x3b09>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Preface, OperationalPattern); } };
+   struct IsRIPPresentItem : ItemDescriptor<bool, 0x0000>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Preface, IsRIPPresent); } };
+
+
 protected:
     PrefaceBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
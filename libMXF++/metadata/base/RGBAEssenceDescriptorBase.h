@@ -46,6 +46,7 @@ class RGBAEssenceDescriptorBase : public GenericPictureEssenceDescriptor
 public:
     friend class MetadataSetFactory<RGBAEssenceDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = RGBAESSENCEDESCRIPTOR_SET_KIND;
 
 public:
     RGBAEssenceDescriptorBase(HeaderMetadata *headerMetadata);
@@ -84,6 +85,20 @@ public:
    void setPaletteLayout(mxfRGBALayout value);
 
 
+   // item descriptors
+
+   struct ComponentMaxRefItem : ItemDescriptor<uint32_t, 0x3406>
+   { static const mxfKey* key() { return &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMaxRef); } };
+   struct ComponentMinRefItem : ItemDescriptor<uint32_t, 0x3407>
+   { static const mxfKey* key() { return &MXF_ITEM_K(RGBAEssenceDescriptor, ComponentMinRef); } };
+   struct AlphaMaxRefItem : ItemDescriptor<uint32_t, 0x3408>
+   { static const mxfKey* key() { return &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMaxRef); } };
+   struct AlphaMinRefItem : ItemDescriptor<uint32_t, 0x3409>
+   { static const mxfKey* key() { return &MXF_ITEM_K(RGBAEssenceDescriptor, AlphaMinRef); } };
+   struct ScanningDirectionItem : ItemDescriptor<uint8_t, 0x3405>
+   { static const mxfKey* key() { return &MXF_ITEM_K(RGBAEssenceDescriptor, ScanningDirection); } };
+
+
 protected:
     RGBAEssenceDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -61,14 +61,7 @@ SequenceBase::~SequenceBase()
 
 std::vector<StructuralComponent*> SequenceBase::getStructuralComponents() const
 {
-    vector<StructuralComponent*> result;
-    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(Sequence, StructuralComponents)));
-    while (iter->next())
-    {
-        MXFPP_CHECK(dynamic_cast<StructuralComponent*>(iter->get()) != 0);
-        result.push_back(dynamic_cast<StructuralComponent*>(iter->get()));
-    }
-    return result;
+    return getRefArrayItemSets<StructuralComponent>(&MXF_ITEM_K(Sequence, StructuralComponents));
 }
 
 void SequenceBase::setStructuralComponents(const std::vector<StructuralComponent*> &value)
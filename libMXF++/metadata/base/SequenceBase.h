@@ -46,6 +46,7 @@ class SequenceBase : public StructuralComponent
 public:
     friend class MetadataSetFactory<SequenceBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = SEQUENCE_SET_KIND;
 
 public:
     SequenceBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class SoundfieldGroupLabelSubDescriptorBase : public MCALabelSubDescriptor
 public:
     friend class MetadataSetFactory<SoundfieldGroupLabelSubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = SOUNDFIELDGROUPLABELSUBDESCRIPTOR_SET_KIND;
 
 public:
     SoundfieldGroupLabelSubDescriptorBase(HeaderMetadata *headerMetadata);
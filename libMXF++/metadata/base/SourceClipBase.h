@@ -46,6 +46,7 @@ class SourceClipBase : public StructuralComponent
 public:
     friend class MetadataSetFactory<SourceClipBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = SOURCECLIP_SET_KIND;
 
 public:
     SourceClipBase(HeaderMetadata *headerMetadata);
@@ -66,6 +67,16 @@ public:
    void setSourceTrackID(uint32_t value);
 
 
+   // item descriptors
+
+   struct StartPositionItem : ItemDescriptor<int64_t, 0x1201>
+   { static const mxfKey* key() { return &MXF_ITEM_K(SourceClip, StartPosition); } };
+   struct SourcePackageIDItem : ItemDescriptor<mxfUMID, 0x1101>
+   { static const mxfKey* key() { return &MXF_ITEM_K(SourceClip, SourcePackageID); } };
+   struct SourceTrackIDItem : ItemDescriptor<uint32_t, 0x1102>
+   { static const mxfKey* key() { return &MXF_ITEM_K(SourceClip, SourceTrackID); } };
+
+
 protected:
     SourceClipBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class SourcePackageBase : public GenericPackage
 public:
     friend class MetadataSetFactory<SourcePackageBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = SOURCEPACKAGE_SET_KIND;
 
 public:
     SourcePackageBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class StaticTrackBase : public GenericTrack
 public:
     friend class MetadataSetFactory<StaticTrackBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = STATICTRACK_SET_KIND;
 
 public:
     StaticTrackBase(HeaderMetadata *headerMetadata);
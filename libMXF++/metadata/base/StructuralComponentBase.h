@@ -46,6 +46,7 @@ class StructuralComponentBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<StructuralComponentBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = STRUCTURALCOMPONENT_SET_KIND;
 
 public:
     StructuralComponentBase(HeaderMetadata *headerMetadata);
@@ -65,6 +66,14 @@ public:
    void setDuration(int64_t value);
 
 
+   // item descriptors
+
+   struct DataDefinitionItem : ItemDescriptor<mxfUL, 0x0201>
+   { static const mxfKey* key() { return &MXF_ITEM_K(StructuralComponent, DataDefinition); } };
+   struct DurationItem : ItemDescriptor<int64_t, 0x0202>
+   { static const mxfKey* key() { return &MXF_ITEM_K(StructuralComponent, Duration); } };
+
+
 protected:
     StructuralComponentBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class SubDescriptorBase : public InterchangeObject
 public:
     friend class MetadataSetFactory<SubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = SUBDESCRIPTOR_SET_KIND;
 
 public:
     SubDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class TextBasedDMFrameworkBase : public DMFramework
 public:
     friend class MetadataSetFactory<TextBasedDMFrameworkBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = TEXTBASEDDMFRAMEWORK_SET_KIND;
 
 public:
     TextBasedDMFrameworkBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class TextBasedObjectBase : public DMSet
 public:
     friend class MetadataSetFactory<TextBasedObjectBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = TEXTBASEDOBJECT_SET_KIND;
 
 public:
     TextBasedObjectBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class TextLocatorBase : public Locator
 public:
     friend class MetadataSetFactory<TextLocatorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = TEXTLOCATOR_SET_KIND;
 
 public:
     TextLocatorBase(HeaderMetadata *headerMetadata);
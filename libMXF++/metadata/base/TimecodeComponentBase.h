@@ -46,6 +46,7 @@ class TimecodeComponentBase : public StructuralComponent
 public:
     friend class MetadataSetFactory<TimecodeComponentBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = TIMECODECOMPONENT_SET_KIND;
 
 public:
     TimecodeComponentBase(HeaderMetadata *headerMetadata);
@@ -66,6 +67,16 @@ public:
    void setDropFrame(bool value);
 
 
+   // item descriptors
+
+   struct RoundedTimecodeBaseItem : ItemDescriptor<uint16_t, 0x1502>
+   { static const mxfKey* key() { return &MXF_ITEM_K(TimecodeComponent, RoundedTimecodeBase); } };
+   struct StartTimecodeItem : ItemDescriptor<int64_t, 0x1501>
+   { static const mxfKey* key() { return &MXF_ITEM_K(TimecodeComponent, StartTimecode); } };
+   struct DropFrameItem : ItemDescriptor<bool, 0x1503>
+   { static const mxfKey* key() { return &MXF_ITEM_K(TimecodeComponent, DropFrame); } };
+
+
 protected:
     TimecodeComponentBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
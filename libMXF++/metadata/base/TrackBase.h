@@ -46,6 +46,7 @@ class TrackBase : public GenericTrack
 public:
     friend class MetadataSetFactory<TrackBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = TRACK_SET_KIND;
 
 public:
     TrackBase(HeaderMetadata *headerMetadata);
@@ -64,6 +65,14 @@ public:
    void setOrigin(int64_t value);
 
 
+   // item descriptors
+
+   struct EditRateItem : ItemDescriptor<mxfRational, 0x4b01>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Track, EditRate); } };
+   struct OriginItem : ItemDescriptor<int64_t, 0x4b02>
+   { static const mxfKey* key() { return &MXF_ITEM_K(Track, Origin); } };
+
+
 protected:
     TrackBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -46,6 +46,7 @@ class UTF16TextBasedSetBase : public TextBasedObject
 public:
     friend class MetadataSetFactory<UTF16TextBasedSetBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = UTF16TEXTBASEDSET_SET_KIND;
 
 public:
     UTF16TextBasedSetBase(HeaderMetadata *headerMetadata);
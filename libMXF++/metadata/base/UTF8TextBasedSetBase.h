@@ -46,6 +46,7 @@ class UTF8TextBasedSetBase : public TextBasedObject
 public:
     friend class MetadataSetFactory<UTF8TextBasedSetBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = UTF8TEXTBASEDSET_SET_KIND;
 
 public:
     UTF8TextBasedSetBase(HeaderMetadata *headerMetadata);
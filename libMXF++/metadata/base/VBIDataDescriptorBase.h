@@ -46,6 +46,7 @@ class VBIDataDescriptorBase : public GenericDataEssenceDescriptor
 public:
     friend class MetadataSetFactory<VBIDataDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = VBIDATADESCRIPTOR_SET_KIND;
 
 public:
     VBIDataDescriptorBase(HeaderMetadata *headerMetadata);
@@ -46,6 +46,7 @@ class VC2SubDescriptorBase : public SubDescriptor
 public:
     friend class MetadataSetFactory<VC2SubDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = VC2SUBDESCRIPTOR_SET_KIND;
 
 public:
     VC2SubDescriptorBase(HeaderMetadata *headerMetadata);
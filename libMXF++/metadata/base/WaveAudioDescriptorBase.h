@@ -46,6 +46,7 @@ class WaveAudioDescriptorBase : public GenericSoundEssenceDescriptor
 public:
     friend class MetadataSetFactory<WaveAudioDescriptorBase>;
     static const mxfKey setKey;
+    static const MetadataSetKind SET_KIND = WAVEAUDIODESCRIPTOR_SET_KIND;
 
 public:
     WaveAudioDescriptorBase(HeaderMetadata *headerMetadata);
@@ -97,6 +98,34 @@ public:
    void setPeakEnvelopeData(ByteArray value);
 
 
+   // item descriptors
+
+   struct BlockAlignItem : ItemDescriptor<uint16_t, 0x3d0a>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, BlockAlign); } };
+   struct SequenceOffsetItem : ItemDescriptor<uint8_t, 0x3d0b>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, SequenceOffset); } };
+   struct AvgBpsItem : ItemDescriptor<uint32_t, 0x3d09>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, AvgBps); } };
+   struct ChannelAssignmentItem : ItemDescriptor<mxfUL, 0x3d32>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, ChannelAssignment); } };
+   struct PeakEnvelopeVersionItem : ItemDescriptor<uint32_t, 0x3d29>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeVersion); } };
+   struct PeakEnvelopeFormatItem : ItemDescriptor<uint32_t, 0x3d2a>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeFormat); } };
+   struct PointsPerPeakValueItem : ItemDescriptor<uint32_t, 0x3d2b>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PointsPerPeakValue); } };
+   struct PeakEnvelopeBlockSizeItem : ItemDescriptor<uint32_t, 0x3d2c>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeBlockSize); } };
+   struct PeakChannelsItem : ItemDescriptor<uint32_t, 0x3d2d>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakChannels); } };
+   struct PeakFramesItem : ItemDescriptor<uint32_t, 0x3d2e>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakFrames); } };
+   struct PeakOfPeaksPositionItem : ItemDescriptor<int64_t, 0x3d2f>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakOfPeaksPosition); } };
+   struct PeakEnvelopeTimestampItem : ItemDescriptor<mxfTimestamp, 0x3d30>
+   { static const mxfKey* key() { return &MXF_ITEM_K(WaveAudioDescriptor, PeakEnvelopeTimestamp); } };
+
+
 protected:
     WaveAudioDescriptorBase(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet);
 };
@@ -0,0 +1,170 @@
+/*
+ * Benchmark building a 1M entry libMXF++ index table segment
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libMXF++/MXF.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdio>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define NUM_ENTRIES     1000000
+#define GOP_SIZE        12
+#define CHUNK_SIZE      1024
+
+#define NUM_COMPACT_ENTRIES     8000000
+
+static const char BENCHMARK_FILENAME[] = "index_benchmark.mxf";
+
+
+
+static double elapsed_ms(chrono::steady_clock::time_point start)
+{
+    return (double)chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count() / 1000.0;
+}
+
+static IndexTableSegment* createSegment()
+{
+    mxfRational editRate = {25, 1};
+    IndexTableSegment *segment = new IndexTableSegment();
+    segment->setIndexEditRate(editRate);
+    segment->setSliceCount(1);
+    segment->setPosTableCount(0);
+    return segment;
+}
+
+static void getEntry(uint32_t i, int8_t *temporalOffset, int8_t *keyFrameOffset, uint8_t *flags,
+                     uint64_t *streamOffset, uint32_t *sliceOffset)
+{
+    *temporalOffset = (int8_t)((i % GOP_SIZE) == 0 ? 2 : -1);
+    *keyFrameOffset = (int8_t)(-(int)(i % GOP_SIZE));
+    *flags = ((i % GOP_SIZE) == 0 ? 0xc0 : 0x22);
+    *streamOffset = (uint64_t)i * 150000 + (uint64_t)(i / GOP_SIZE) * 450000 + ((uint64_t)i * 2654435761U) % 50000;
+    *sliceOffset = 140000;
+}
+
+int main()
+{
+    uint32_t i, j;
+
+    // per entry append using vectors
+    auto_ptr<IndexTableSegment> segment(createSegment());
+    vector<uint32_t> sliceOffset(1);
+    vector<mxfRational> posTable;
+    int8_t temporalOffset, keyFrameOffset;
+    uint8_t flags;
+    uint64_t streamOffset;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (i = 0; i < NUM_ENTRIES; i++) {
+        getEntry(i, &temporalOffset, &keyFrameOffset, &flags, &streamOffset, &sliceOffset[0]);
+        segment->appendIndexEntry(temporalOffset, keyFrameOffset, flags, streamOffset, sliceOffset, posTable);
+    }
+    printf("%-40s %10.1f ms\n", "appendIndexEntry", elapsed_ms(start));
+    segment.reset();
+
+    // bulk append in chunks
+    segment.reset(createSegment());
+    vector<int8_t> temporalOffsets(CHUNK_SIZE);
+    vector<int8_t> keyFrameOffsets(CHUNK_SIZE);
+    vector<uint8_t> flagsArray(CHUNK_SIZE);
+    vector<uint64_t> streamOffsets(CHUNK_SIZE);
+    vector<uint32_t> sliceOffsets(CHUNK_SIZE);
+    start = chrono::steady_clock::now();
+    segment->reserveIndexEntries(NUM_ENTRIES);
+    for (i = 0; i < NUM_ENTRIES; i += CHUNK_SIZE) {
+        uint32_t count = (NUM_ENTRIES - i < CHUNK_SIZE ? NUM_ENTRIES - i : CHUNK_SIZE);
+        for (j = 0; j < count; j++)
+            getEntry(i + j, &temporalOffsets[j], &keyFrameOffsets[j], &flagsArray[j], &streamOffsets[j],
+                     &sliceOffsets[j]);
+        segment->appendIndexEntries(count, &temporalOffsets[0], &keyFrameOffsets[0], &flagsArray[0],
+                                    &streamOffsets[0], &sliceOffsets[0], 0);
+    }
+    printf("%-40s %10.1f ms\n", "appendIndexEntries (1024 per call)", elapsed_ms(start));
+
+    if (segment->getBulkIndexEntryCount() != NUM_ENTRIES) {
+        fprintf(stderr, "Unexpected bulk index entry count %u\n", segment->getBulkIndexEntryCount());
+        return 1;
+    }
+
+    // segment write
+    {
+        auto_ptr<File> file(File::openNew(BENCHMARK_FILENAME));
+        Partition &partition = file->createPartition();
+        partition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+        partition.write(file.get());
+        start = chrono::steady_clock::now();
+        segment->write(file.get(), &partition, 0);
+        printf("%-40s %10.1f ms\n", "IndexTableSegment::write", elapsed_ms(start));
+    }
+    remove(BENCHMARK_FILENAME);
+    segment.reset();
+
+    // compact index
+    CompactIndexTable compactIndex;
+    start = chrono::steady_clock::now();
+    for (i = 0; i < NUM_COMPACT_ENTRIES; i++) {
+        getEntry(i, &temporalOffset, &keyFrameOffset, &flags, &streamOffset, &sliceOffset[0]);
+        compactIndex.appendEntry(temporalOffset, keyFrameOffset, flags, streamOffset);
+    }
+    compactIndex.shrinkToFit();
+    printf("%-40s %10.1f ms\n", "CompactIndexTable::appendEntry", elapsed_ms(start));
+    printf("%-40s %10.1f MB\n", "CompactIndexTable memory", compactIndex.getMemorySize() / 1000000.0);
+
+    uint64_t position = 1;
+    start = chrono::steady_clock::now();
+    for (i = 0; i < NUM_COMPACT_ENTRIES; i++) {
+        position = (position * 6364136223846793005ULL + 1442695040888963407ULL);
+        uint32_t index = (uint32_t)((position >> 33) % NUM_COMPACT_ENTRIES);
+        uint64_t compactStreamOffset;
+        int8_t compactTemporalOffset, compactKeyFrameOffset;
+        uint8_t compactFlags;
+        compactIndex.getEntry(index, &compactTemporalOffset, &compactKeyFrameOffset, &compactFlags,
+                              &compactStreamOffset);
+        getEntry(index, &temporalOffset, &keyFrameOffset, &flags, &streamOffset, &sliceOffset[0]);
+        if (compactStreamOffset != streamOffset || compactFlags != flags ||
+            compactKeyFrameOffset != keyFrameOffset || compactTemporalOffset != temporalOffset)
+        {
+            fprintf(stderr, "Compact index entry %u mismatch\n", index);
+            return 1;
+        }
+    }
+    printf("%-40s %10.1f ns\n", "CompactIndexTable::getEntry (random)",
+           elapsed_ms(start) * 1000000.0 / NUM_COMPACT_ENTRIES);
+
+    return 0;
+}
@@ -44,6 +44,9 @@ using namespace mxfpp;
 
 
 static const char TEST_WRITE_FILENAME[] = "write_test.mxf";
+static const char TEST_INDEX_FILENAME[] = "index_test.mxf";
+static const char TEST_LARGE_HEADER_FILENAME[] = "large_header_test.mxf";
+static const char TEST_HEADER_FILENAME[] = "header_test.mxf";
 
 
 
@@ -116,6 +119,7 @@ static void testRead(string filename)
     auto_ptr<File> file(File::openRead(filename));
     auto_ptr<DataModel> dataModel(new DataModel());
     auto_ptr<AvidHeaderMetadata> headerMetadata(new AvidHeaderMetadata(dataModel.get()));
+    headerMetadata->enableArenaAllocation();
 
 
     // read header partition
@@ -145,13 +149,36 @@ static void testRead(string filename)
         preface->getGenerationUID();
     }
     printf("Preface::Version = %u\n", preface->getVersion());
+    if (preface->getItem<Preface::VersionItem>() != preface->getVersion())
+    {
+        throw "Preface version item descriptor mismatch";
+    }
+    if (preface->getSetKind() != PREFACE_SET_KIND || !preface->isKindOf(INTERCHANGEOBJECT_SET_KIND) ||
+        metadata_set_cast<GenericPackage>(preface) != 0)
+    {
+        throw "Preface set kind mismatch";
+    }
     printf("size Preface::Identifications = %d\n", (int)preface->getIdentifications().size());
     printf("size Preface::EssenceContainers = %d\n", (int)preface->getEssenceContainers().size());
+    if (preface->getULArrayItemView(&MXF_ITEM_K(Preface, EssenceContainers)).size() !=
+            preface->getEssenceContainers().size())
+    {
+        throw "Essence containers array view size mismatch";
+    }
 
     if (preface->getIdentifications().size() > 0)
     {
         Identification *identification = *preface->getIdentifications().begin();
         printf("Identification::CompanyName = '%s'\n", identification->getCompanyName().c_str());
+
+        char companyName[4];
+        size_t companyNameLen = identification->getStringItem(&MXF_ITEM_K(Identification, CompanyName),
+                                                              companyName, sizeof(companyName));
+        if (companyNameLen != identification->getCompanyName().size() ||
+            identification->getCompanyName().compare(0, sizeof(companyName) - 1, companyName) != 0)
+        {
+            throw "Company name buffer transcode mismatch";
+        }
     }
 
     ContentStorage *storage = preface->getContentStorage();
@@ -160,6 +187,49 @@ static void testRead(string filename)
         storage->getEssenceContainerData();
     }
 
+    HeaderMetadata::MemoryStats memoryStats;
+    headerMetadata->getMemoryStats(&memoryStats);
+    printf("Header metadata: %u sets, %u items, %u item value bytes, %u wrappers, %u read end bytes\n",
+           (unsigned int)memoryStats.setCount, (unsigned int)memoryStats.itemCount,
+           (unsigned int)memoryStats.itemValueBytes, (unsigned int)memoryStats.wrapperCount,
+           (unsigned int)memoryStats.readEndBytes);
+    if (memoryStats.setCount == 0 || memoryStats.wrapperCount == 0 || memoryStats.wrapperBytes == 0 ||
+        memoryStats.readEndBytes < memoryStats.itemValueBytes || memoryStats.arenaAllocatedBytes == 0)
+    {
+        throw "Header metadata memory stats mismatch";
+    }
+
+    headerMetadata->freeze();
+    if (headerMetadata->getPreface() != preface || preface->getContentStorage() != storage)
+    {
+        throw "Frozen header metadata getters mismatch";
+    }
+    bool rejected = false;
+    try
+    {
+        preface->setVersion(MXF_PREFACE_VER(1, 3));
+    }
+    catch (MXFException &ex)
+    {
+        rejected = true;
+    }
+    if (!rejected)
+    {
+        throw "Frozen header metadata accepted a modification";
+    }
+
+    auto_ptr<HeaderMetadata> clonedHeaderMetadata(new HeaderMetadata(dataModel.get()));
+    headerMetadata->cloneAll(clonedHeaderMetadata.get(), true);
+    Preface *clonedPreface = clonedHeaderMetadata->getPreface();
+    mxfUUID prefaceUID = preface->getInstanceUID();
+    mxfUUID clonedPrefaceUID = clonedPreface->getInstanceUID();
+    if (mxf_equals_uuid(&prefaceUID, &clonedPrefaceUID) ||
+        clonedPreface->getIdentifications().size() != preface->getIdentifications().size() ||
+        clonedPreface->getContentStorage()->getHeaderMetadata() != clonedHeaderMetadata.get())
+    {
+        throw "Cloned header metadata mismatch";
+    }
+
     // read remaining KLVs
     printf("Reading remaining KLVs\n");
     while (1)
@@ -176,6 +246,1144 @@ static void testRead(string filename)
 
 }
 
+static void testWriteLargeHeader()
+{
+    auto_ptr<File> file(File::openNew(TEST_LARGE_HEADER_FILENAME));
+    file->setMinLLen(4);
+
+    Partition& headerPartition = file->createPartition();
+    headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+    headerPartition.setVersion(1, 2);
+    headerPartition.setKagSize(0x100);
+    headerPartition.setOperationalPattern(&MXF_OP_L(atom, NTracks_1SourceClip));
+    headerPartition.write(file.get());
+
+    auto_ptr<DataModel> dataModel(new DataModel());
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel.get()));
+
+    // a sequence with enough source clips to have the header sets decoded by multiple threads
+    Preface *preface = new Preface(headerMetadata.get());
+    preface->setVersion(MXF_PREFACE_VER(1, 2));
+    preface->setContentStorage(new ContentStorage(headerMetadata.get()));
+    MaterialPackage *materialPackage = new MaterialPackage(headerMetadata.get());
+    preface->getContentStorage()->appendPackages(materialPackage);
+    Track *track = new Track(headerMetadata.get());
+    materialPackage->appendTracks(track);
+    Sequence *sequence = new Sequence(headerMetadata.get());
+    track->setSequence(sequence);
+    int i;
+    for (i = 0; i < 2000; i++)
+    {
+        SourceClip *sourceClip = new SourceClip(headerMetadata.get());
+        sourceClip->setDuration(i + 1);
+        sequence->appendStructuralComponents(sourceClip);
+    }
+
+    headerMetadata->write(file.get(), &headerPartition, 0);
+
+    Partition &footerPartition = file->createPartition();
+    footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+    footerPartition.write(file.get());
+
+    file->writeRIP();
+    file->updatePartitions();
+}
+
+static void writeHeaderFile(HeaderMetadata *headerMetadata, File *file)
+{
+    file->setMinLLen(4);
+
+    Partition& headerPartition = file->createPartition();
+    headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+    headerPartition.setVersion(1, 2);
+    headerPartition.setKagSize(0x100);
+    headerPartition.setOperationalPattern(&MXF_OP_L(atom, NTracks_1SourceClip));
+    headerPartition.write(file);
+
+    headerMetadata->write(file, &headerPartition, 0);
+
+    Partition &footerPartition = file->createPartition();
+    footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+    footerPartition.write(file);
+
+    file->writeRIP();
+    file->updatePartitions();
+}
+
+static void writeHeaderFile(HeaderMetadata *headerMetadata, const char *filename)
+{
+    auto_ptr<File> file(File::openNew(filename));
+    writeHeaderFile(headerMetadata, file.get());
+}
+
+static void readFileBytes(const char *filename, vector<unsigned char> *bytes)
+{
+    auto_ptr<File> file(File::openRead(filename));
+    bytes->resize((size_t)file->size());
+    if (!bytes->empty() && file->read(&(*bytes)[0], (uint32_t)bytes->size()) != bytes->size())
+    {
+        throw "Failed to read file bytes";
+    }
+}
+
+static HeaderMetadata* createTestHeaderMetadata(DataModel *dataModel, SourceClip **sourceClip)
+{
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel));
+
+    // the Preface is deliberately not the first set in the header metadata
+    ContentStorage *contentStorage = new ContentStorage(headerMetadata.get());
+    MaterialPackage *materialPackage = new MaterialPackage(headerMetadata.get());
+    materialPackage->setPackageUID(g_Null_UMID);
+    contentStorage->appendPackages(materialPackage);
+    Track *track = new Track(headerMetadata.get());
+    track->setTrackID(1);
+    materialPackage->appendTracks(track);
+    *sourceClip = new SourceClip(headerMetadata.get());
+    (*sourceClip)->setDuration(10);
+    track->setSequence(*sourceClip);
+
+    Preface *preface = new Preface(headerMetadata.get());
+    preface->setVersion(MXF_PREFACE_VER(1, 2));
+    preface->appendIdentifications(new Identification(headerMetadata.get()));
+    preface->getIdentifications()[0]->setCompanyName("a company");
+    preface->setContentStorage(contentStorage);
+
+    return headerMetadata.release();
+}
+
+static void testWriteCache()
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+    SourceClip *sourceClip;
+    auto_ptr<HeaderMetadata> headerMetadata(createTestHeaderMetadata(dataModel.get(), &sourceClip));
+
+    vector<unsigned char> firstBytes;
+    vector<unsigned char> cachedBytes;
+    vector<unsigned char> uncachedBytes;
+
+    headerMetadata->enableWriteCache();
+    writeHeaderFile(headerMetadata.get(), TEST_HEADER_FILENAME);
+    readFileBytes(TEST_HEADER_FILENAME, &firstBytes);
+
+    sourceClip->setDuration(20);
+    writeHeaderFile(headerMetadata.get(), TEST_HEADER_FILENAME);
+    readFileBytes(TEST_HEADER_FILENAME, &cachedBytes);
+
+    headerMetadata->enableWriteCache(false);
+    writeHeaderFile(headerMetadata.get(), TEST_HEADER_FILENAME);
+    readFileBytes(TEST_HEADER_FILENAME, &uncachedBytes);
+
+    if (firstBytes.size() != cachedBytes.size() || firstBytes == cachedBytes || cachedBytes != uncachedBytes)
+    {
+        throw "Cached header metadata write differs from uncached write";
+    }
+}
+
+static HeaderMetadata* readHeaderMetadata(File *file, DataModel *dataModel, bool parallel)
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+
+    file->seek(0, SEEK_SET);
+    if (!file->readHeaderPartition())
+    {
+        throw "Could not find header partition";
+    }
+
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel));
+    file->readNextNonFillerKL(&key, &llen, &len);
+    if (!HeaderMetadata::isHeaderMetadata(&key))
+    {
+        throw "Could not find header metadata in header partition";
+    }
+    if (parallel)
+        headerMetadata->readParallel(file, &file->getPartition(0), &key, llen, len, 4);
+    else
+        headerMetadata->read(file, &file->getPartition(0), &key, llen, len);
+
+    return headerMetadata.release();
+}
+
+static void testPatchItems()
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+    SourceClip *sourceClip;
+    auto_ptr<HeaderMetadata> headerMetadata(createTestHeaderMetadata(dataModel.get(), &sourceClip));
+    Identification *identification = headerMetadata->getPreface()->getIdentifications()[0];
+
+    headerMetadata->registerPatchItem(sourceClip, &MXF_ITEM_K(StructuralComponent, Duration));
+    headerMetadata->registerPatchItem(identification, &MXF_ITEM_K(Identification, CompanyName));
+
+    int64_t fileSize;
+    {
+        auto_ptr<File> file(File::openNew(TEST_HEADER_FILENAME));
+        writeHeaderFile(headerMetadata.get(), file.get());
+        fileSize = file->size();
+
+        sourceClip->setDuration(250);
+        identification->setCompanyName("a longer company");
+        bool rejected = false;
+        try
+        {
+            headerMetadata->patchItems(file.get());
+        }
+        catch (MXFException &ex)
+        {
+            rejected = true;
+        }
+        if (!rejected)
+        {
+            throw "Patching an item with a changed size was accepted";
+        }
+
+        identification->setCompanyName("b company");
+        headerMetadata->patchItems(file.get());
+        if (file->size() != fileSize)
+        {
+            throw "Patching items changed the file size";
+        }
+    }
+
+    auto_ptr<File> file(File::openRead(TEST_HEADER_FILENAME));
+    auto_ptr<HeaderMetadata> patchedHeaderMetadata(readHeaderMetadata(file.get(), dataModel.get(), false));
+    Preface *preface = patchedHeaderMetadata->getPreface();
+    SourceClip *readSourceClip = dynamic_cast<SourceClip*>(
+        preface->getContentStorage()->getPackages()[0]->getTracks()[0]->getSequence());
+    if (file->size() != fileSize || !readSourceClip || readSourceClip->getDuration() != 250 ||
+        preface->getIdentifications()[0]->getCompanyName() != "b company")
+    {
+        throw "Patched header metadata items mismatch";
+    }
+}
+
+static void testHeaderTemplate()
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+    SourceClip *sourceClip;
+    auto_ptr<HeaderMetadata> headerMetadata(createTestHeaderMetadata(dataModel.get(), &sourceClip));
+    GenericPackage *materialPackage = headerMetadata->getPreface()->getContentStorage()->getPackages()[0];
+
+    HeaderMetadataTemplate headerTemplate(headerMetadata.get());
+    size_t packageUIDIndex = headerTemplate.registerPatchItem(materialPackage,
+                                                              &MXF_ITEM_K(GenericPackage, PackageUID));
+    size_t durationIndex = headerTemplate.registerPatchItem(sourceClip, &MXF_ITEM_K(StructuralComponent, Duration));
+    headerTemplate.compile(4);
+
+    mxfUMID packageUID;
+    mxf_generate_umid(&packageUID);
+    headerTemplate.setUMIDItem(packageUIDIndex, packageUID);
+    headerTemplate.setInt64Item(durationIndex, 500);
+
+    {
+        auto_ptr<File> file(File::openNew(TEST_HEADER_FILENAME));
+        file->setMinLLen(4);
+
+        Partition& headerPartition = file->createPartition();
+        headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+        headerPartition.setVersion(1, 2);
+        headerPartition.setKagSize(0x100);
+        headerPartition.setOperationalPattern(&MXF_OP_L(atom, NTracks_1SourceClip));
+        headerPartition.write(file.get());
+
+        // the template bytes are encoded with a 4 byte llen
+        file->setMinLLen(8);
+        bool rejected = false;
+        try
+        {
+            headerTemplate.write(file.get(), &headerPartition, 0);
+        }
+        catch (MXFException &ex)
+        {
+            rejected = true;
+        }
+        if (!rejected)
+        {
+            throw "Header metadata template write with a different llen was accepted";
+        }
+
+        file->setMinLLen(4);
+        headerTemplate.write(file.get(), &headerPartition, 0);
+
+        Partition &footerPartition = file->createPartition();
+        footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+        footerPartition.write(file.get());
+
+        file->writeRIP();
+        file->updatePartitions();
+    }
+
+    auto_ptr<File> file(File::openRead(TEST_HEADER_FILENAME));
+    auto_ptr<HeaderMetadata> readHeader(readHeaderMetadata(file.get(), dataModel.get(), false));
+    GenericPackage *readPackage = readHeader->getPreface()->getContentStorage()->getPackages()[0];
+    SourceClip *readSourceClip = dynamic_cast<SourceClip*>(readPackage->getTracks()[0]->getSequence());
+    if (readPackage->getPackageUID() != packageUID || !readSourceClip || readSourceClip->getDuration() != 500 ||
+        readHeader->getPreface()->getIdentifications()[0]->getCompanyName() != "a company")
+    {
+        throw "Header metadata template read back mismatch";
+    }
+}
+
+static void testArenaHeaderMetadata()
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+
+    auto_ptr<DataModel> dataModel(new DataModel());
+    auto_ptr<File> file(File::openRead(TEST_LARGE_HEADER_FILENAME));
+    if (!file->readHeaderPartition())
+    {
+        throw "Could not find header partition";
+    }
+
+    // a small block size results in the object directory buckets being spread over multiple arena blocks
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel.get()));
+    headerMetadata->enableArenaAllocation(4096);
+    file->readNextNonFillerKL(&key, &llen, &len);
+    if (!HeaderMetadata::isHeaderMetadata(&key))
+    {
+        throw "Could not find header metadata in header partition";
+    }
+    headerMetadata->read(file.get(), &file->getPartition(0), &key, llen, len);
+
+    // wrapping the sets fills the object directory
+    ::MXFListIterator iter;
+    mxf_initialise_list_iter(&iter, &headerMetadata->getCHeaderMetadata()->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        headerMetadata->wrap((::MXFMetadataSet*)mxf_get_iter_element(&iter));
+    }
+
+    HeaderMetadata::MemoryStats memoryStats;
+    headerMetadata->getMemoryStats(&memoryStats);
+    if (memoryStats.wrapperCount < 2000 || memoryStats.arenaReservedBytes <= 4096)
+    {
+        throw "Arena header metadata memory stats mismatch";
+    }
+
+    // the object directory is released before the arena blocks it was allocated from.
+    // Run under AddressSanitizer to detect a use after free
+    headerMetadata.reset();
+}
+
+static void testParallelRead(string filename, size_t minSetCount)
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+
+    auto_ptr<File> serialFile(File::openRead(filename));
+    auto_ptr<HeaderMetadata> serialHeaderMetadata(readHeaderMetadata(serialFile.get(), dataModel.get(), false));
+    auto_ptr<File> parallelFile(File::openRead(filename));
+    auto_ptr<HeaderMetadata> parallelHeaderMetadata(readHeaderMetadata(parallelFile.get(), dataModel.get(), true));
+
+    ::MXFList *serialSets = &serialHeaderMetadata->getCHeaderMetadata()->sets;
+    ::MXFList *parallelSets = &parallelHeaderMetadata->getCHeaderMetadata()->sets;
+    if (mxf_get_list_length(serialSets) != mxf_get_list_length(parallelSets))
+    {
+        throw "Parallel read set count differs from serial read";
+    }
+    if (mxf_get_list_length(serialSets) < minSetCount)
+    {
+        throw "Parallel read test file has too few sets";
+    }
+
+    ::MXFListIterator serialIter;
+    ::MXFListIterator parallelIter;
+    mxf_initialise_list_iter(&serialIter, serialSets);
+    mxf_initialise_list_iter(&parallelIter, parallelSets);
+    while (mxf_next_list_iter_element(&serialIter) && mxf_next_list_iter_element(&parallelIter))
+    {
+        ::MXFMetadataSet *serialSet = (::MXFMetadataSet*)mxf_get_iter_element(&serialIter);
+        ::MXFMetadataSet *parallelSet = (::MXFMetadataSet*)mxf_get_iter_element(&parallelIter);
+        if (serialSet->key != parallelSet->key ||
+            serialSet->instanceUID != parallelSet->instanceUID ||
+            mxf_get_list_length(&serialSet->items) != mxf_get_list_length(&parallelSet->items))
+        {
+            throw "Parallel read set differs from serial read";
+        }
+    }
+
+    ::MXFMetadataSet *cSet;
+    if (mxf_find_singular_set_by_key(serialHeaderMetadata->getCHeaderMetadata(), &MXF_SET_K(Sequence), &cSet))
+    {
+        Sequence *serialSequence = dynamic_cast<Sequence*>(serialHeaderMetadata->wrap(cSet));
+        MXFPP_CHECK(mxf_find_singular_set_by_key(parallelHeaderMetadata->getCHeaderMetadata(),
+                                                 &MXF_SET_K(Sequence), &cSet));
+        Sequence *parallelSequence = dynamic_cast<Sequence*>(parallelHeaderMetadata->wrap(cSet));
+        if (serialSequence->getStructuralComponentsDuration() != parallelSequence->getStructuralComponentsDuration())
+        {
+            throw "Parallel read sequence duration differs from serial read";
+        }
+        SourceClip *serialClip = dynamic_cast<SourceClip*>(serialSequence->getStructuralComponents().back());
+        SourceClip *parallelClip = dynamic_cast<SourceClip*>(parallelSequence->getStructuralComponents().back());
+        if (!serialClip || !parallelClip || serialClip->getDuration() != parallelClip->getDuration())
+        {
+            throw "Parallel read source clip differs from serial read";
+        }
+    }
+
+    printf("Parallel read matches serial read (%d sets)\n", (int)mxf_get_list_length(serialSets));
+}
+
+static void testSequenceIndex()
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel.get()));
+
+    Sequence *sequence = new Sequence(headerMetadata.get());
+    int i;
+    for (i = 0; i < 3; i++)
+    {
+        SourceClip *sourceClip = new SourceClip(headerMetadata.get());
+        sourceClip->setDuration(10 * (i + 1));
+        sequence->appendStructuralComponents(sourceClip);
+    }
+
+    int64_t offset;
+    size_t index;
+    if (sequence->getStructuralComponentsDuration() != 60 ||
+        !sequence->findStructuralComponent(25, &offset, &index) || index != 1 || offset != 15 ||
+        sequence->findStructuralComponent(60, &offset))
+    {
+        throw "Sequence component index mismatch";
+    }
+
+    SourceClip *sourceClip = new SourceClip(headerMetadata.get());
+    sourceClip->setDuration(5);
+    sequence->appendStructuralComponents(sourceClip);
+    if (sequence->findStructuralComponent(62, &offset, &index) != sourceClip || index != 3 || offset != 2)
+    {
+        throw "Sequence component index not updated after append";
+    }
+
+    // a component with an unknown duration makes the positions after it unknown
+    sequence->appendStructuralComponents(new SourceClip(headerMetadata.get()));
+    if (sequence->getStructuralComponentsDuration() != -1 ||
+        sequence->findStructuralComponent(62, &offset, &index) != sourceClip)
+    {
+        throw "Sequence component index with an unknown duration mismatch";
+    }
+    bool rejected = false;
+    try
+    {
+        sequence->findStructuralComponent(65, &offset);
+    }
+    catch (MXFException &ex)
+    {
+        rejected = true;
+    }
+    if (!rejected)
+    {
+        throw "Sequence position after an unknown duration was accepted";
+    }
+}
+
+static void testPackageGraph()
+{
+    auto_ptr<DataModel> dataModel(new DataModel());
+    auto_ptr<HeaderMetadata> headerMetadata(new HeaderMetadata(dataModel.get()));
+
+    Preface *preface = new Preface(headerMetadata.get());
+    preface->setContentStorage(new ContentStorage(headerMetadata.get()));
+
+    mxfUMID fileSourcePackageUID;
+    mxfUMID materialPackageUID;
+    mxf_generate_umid(&fileSourcePackageUID);
+    mxf_generate_umid(&materialPackageUID);
+
+    SourcePackage *fileSourcePackage = new SourcePackage(headerMetadata.get());
+    fileSourcePackage->setPackageUID(fileSourcePackageUID);
+    fileSourcePackage->setDescriptor(new WaveAudioDescriptor(headerMetadata.get()));
+    preface->getContentStorage()->appendPackages(fileSourcePackage);
+    Track *fileSourceTrack = new Track(headerMetadata.get());
+    fileSourceTrack->setTrackID(1);
+    fileSourceTrack->setSequence(new SourceClip(headerMetadata.get()));
+    fileSourcePackage->appendTracks(fileSourceTrack);
+
+    // track 1 references the file source track and track 2 references a track that doesn't exist
+    MaterialPackage *materialPackage = new MaterialPackage(headerMetadata.get());
+    materialPackage->setPackageUID(materialPackageUID);
+    preface->getContentStorage()->appendPackages(materialPackage);
+    uint32_t i;
+    for (i = 0; i < 2; i++)
+    {
+        Track *materialTrack = new Track(headerMetadata.get());
+        materialTrack->setTrackID(i + 1);
+        Sequence *sequence = new Sequence(headerMetadata.get());
+        SourceClip *sourceClip = new SourceClip(headerMetadata.get());
+        sourceClip->setSourcePackageID(fileSourcePackageUID);
+        sourceClip->setSourceTrackID(i == 0 ? 1 : 9);
+        sequence->appendStructuralComponents(sourceClip);
+        materialTrack->setSequence(sequence);
+        materialPackage->appendTracks(materialTrack);
+    }
+
+    PackageGraph *packageGraph = headerMetadata->getPackageGraph();
+    const vector<PackageGraph::MaterialTrackChain> &chains = packageGraph->getMaterialTrackChains();
+    if (chains.size() != 2 ||
+        chains[0].materialPackage != materialPackage || !chains[0].sourceClip ||
+        chains[0].fileSourcePackage != fileSourcePackage || chains[0].fileSourceTrack != fileSourceTrack ||
+        !chains[1].sourceClip || chains[1].fileSourcePackage != 0 || chains[1].fileSourceTrack != 0)
+    {
+        throw "Package graph material track chain mismatch";
+    }
+
+    GenericTrack *resolvedTrack = 0;
+    if (packageGraph->resolveFileSourcePackage(materialPackageUID, 1, &resolvedTrack) != fileSourcePackage ||
+        resolvedTrack != fileSourceTrack ||
+        packageGraph->resolveFileSourcePackage(materialPackageUID, 2, &resolvedTrack) != 0 ||
+        packageGraph->findPackage(fileSourcePackageUID) != fileSourcePackage ||
+        packageGraph->findTrack(materialPackageUID, 2) != chains[1].materialTrack)
+    {
+        throw "Package graph resolution mismatch";
+    }
+
+    // the graph is rebuilt after a change
+    materialPackage->getTracks()[1]->setTrackID(3);
+    if (headerMetadata->getPackageGraph()->findTrack(materialPackageUID, 3) == 0)
+    {
+        throw "Package graph not rebuilt after modification";
+    }
+
+    // a frozen header metadata without a content storage has no package graph
+    auto_ptr<HeaderMetadata> emptyHeaderMetadata(new HeaderMetadata(dataModel.get()));
+    Preface *emptyPreface = new Preface(emptyHeaderMetadata.get());
+    emptyHeaderMetadata->freeze();
+    bool rejected = false;
+    try
+    {
+        emptyPreface->findPackage(materialPackageUID);
+    }
+    catch (MXFException &ex)
+    {
+        rejected = true;
+    }
+    if (!rejected)
+    {
+        throw "Frozen header metadata without a content storage returned a package";
+    }
+}
+
+static IndexTableSegment* writeAndReadIndexSegment(IndexTableSegment *segment)
+{
+    {
+        auto_ptr<File> file(File::openNew(TEST_INDEX_FILENAME));
+
+        Partition& headerPartition = file->createPartition();
+        headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+        headerPartition.setKagSize(0x100);
+        headerPartition.setIndexSID(segment->getIndexSID());
+        headerPartition.write(file.get());
+        segment->write(file.get(), &headerPartition, 0);
+
+        Partition &footerPartition = file->createPartition();
+        footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+        footerPartition.write(file.get());
+
+        file->writeRIP();
+        file->updatePartitions();
+    }
+
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    auto_ptr<File> file(File::openRead(TEST_INDEX_FILENAME));
+    if (!file->readHeaderPartition())
+    {
+        throw "Could not find header partition";
+    }
+    file->readNextNonFillerKL(&key, &llen, &len);
+    if (!IndexTableSegment::isIndexTableSegment(&key))
+    {
+        throw "Could not find index table segment in header partition";
+    }
+
+    return IndexTableSegment::read(file.get(), len);
+}
+
+static void testIndexSegmentRoundTrip()
+{
+    mxfRational editRate = {25, 1};
+    IndexTableSegment segment;
+    segment.setIndexSID(3);
+    segment.setBodySID(4);
+    segment.setIndexEditRate(editRate);
+    segment.setIndexStartPosition(100);
+    segment.setIndexDuration(10);
+    segment.setSliceCount(1);
+    segment.setPosTableCount(1);
+    segment.appendDeltaEntry(0, 0, 0);
+    segment.appendDeltaEntry(-1, 1, 20);
+
+    // 3 list entries followed by 6 bulk entries and a final entry that is appended to the bulk arrays
+    vector<uint32_t> sliceOffset(1);
+    vector<mxfRational> posTable(1);
+    int8_t temporalOffsets[10];
+    int8_t keyFrameOffsets[10];
+    uint8_t flags[10];
+    uint64_t streamOffsets[10];
+    uint32_t sliceOffsets[10];
+    mxfRational posTables[10];
+    int i;
+    for (i = 0; i < 10; i++)
+    {
+        temporalOffsets[i] = (int8_t)(i % 3 - 1);
+        keyFrameOffsets[i] = (int8_t)(-i);
+        flags[i] = (i == 0 ? 0xc0 : 0x22);
+        streamOffsets[i] = i * 1000 + ((uint64_t)1 << 33);
+        sliceOffsets[i] = i * 10 + 1;
+        posTables[i].numerator = -i;
+        posTables[i].denominator = i + 1;
+    }
+    for (i = 0; i < 3; i++)
+    {
+        sliceOffset[0] = sliceOffsets[i];
+        posTable[0] = posTables[i];
+        segment.appendIndexEntry(temporalOffsets[i], keyFrameOffsets[i], flags[i], streamOffsets[i],
+                                 sliceOffset, posTable);
+    }
+    segment.appendIndexEntries(6, &temporalOffsets[3], &keyFrameOffsets[3], &flags[3], &streamOffsets[3],
+                               &sliceOffsets[3], &posTables[3]);
+    sliceOffset[0] = sliceOffsets[9];
+    posTable[0] = posTables[9];
+    segment.appendIndexEntry(temporalOffsets[9], keyFrameOffsets[9], flags[9], streamOffsets[9],
+                             sliceOffset, posTable);
+    if (segment.getBulkIndexEntryCount() != 7)
+    {
+        throw "Bulk index entry count mismatch";
+    }
+
+    // the accessors cover both the libMXF entry list and the bulk arrays
+    if (segment.getNumIndexEntries() != 10)
+    {
+        throw "Index entry count mismatch";
+    }
+    int8_t temporalOffset;
+    int8_t keyFrameOffset;
+    uint8_t entryFlags;
+    uint64_t streamOffset;
+    for (i = 0; i < 10; i++)
+    {
+        if (!segment.getIndexEntry(i, &temporalOffset, &keyFrameOffset, &entryFlags, &streamOffset,
+                                   &sliceOffset, &posTable) ||
+            temporalOffset != temporalOffsets[i] || keyFrameOffset != keyFrameOffsets[i] ||
+            entryFlags != flags[i] || streamOffset != streamOffsets[i] ||
+            sliceOffset.size() != 1 || sliceOffset[0] != sliceOffsets[i] ||
+            posTable.size() != 1 || posTable[0].numerator != posTables[i].numerator ||
+            posTable[0].denominator != posTables[i].denominator)
+        {
+            throw "Index entry accessor mismatch";
+        }
+    }
+    if (segment.getIndexEntry(10, &temporalOffset, &keyFrameOffset, &entryFlags, &streamOffset, 0, 0))
+    {
+        throw "Index entry accessor accepted an out of range index";
+    }
+
+    auto_ptr<IndexTableSegment> readSegment(writeAndReadIndexSegment(&segment));
+    mxfRational readEditRate = readSegment->getIndexEditRate();
+    if (readSegment->getIndexSID() != 3 || readSegment->getBodySID() != 4 || readEditRate != editRate ||
+        readSegment->getIndexStartPosition() != 100 || readSegment->getIndexDuration() != 10 ||
+        readSegment->getSliceCount() != 1 || readSegment->getPosTableCount() != 1)
+    {
+        throw "Index table segment round trip header mismatch";
+    }
+
+    const vector<MXFDeltaEntry> &deltaEntries = readSegment->getDeltaEntries();
+    if (deltaEntries.size() != 2 ||
+        deltaEntries[1].posTableIndex != -1 || deltaEntries[1].slice != 1 || deltaEntries[1].elementData != 20)
+    {
+        throw "Index table segment round trip delta entry mismatch";
+    }
+
+    const ::MXFIndexEntry *entry = readSegment->getCIndexTableSegment()->indexEntryArray;
+    for (i = 0; i < 10; i++)
+    {
+        if (!entry ||
+            entry->temporalOffset != temporalOffsets[i] || entry->keyFrameOffset != keyFrameOffsets[i] ||
+            entry->flags != flags[i] || entry->streamOffset != streamOffsets[i] ||
+            !entry->sliceOffset || entry->sliceOffset[0] != sliceOffsets[i] ||
+            !entry->posTable || entry->posTable[0].numerator != posTables[i].numerator ||
+            entry->posTable[0].denominator != posTables[i].denominator)
+        {
+            throw "Index table segment round trip index entry mismatch";
+        }
+        entry = entry->next;
+    }
+    if (entry)
+    {
+        throw "Index table segment round trip has too many index entries";
+    }
+}
+
+static void testDeltaEntryLookup()
+{
+    mxfRational editRate = {25, 1};
+    IndexTableSegment segment;
+    segment.setIndexSID(1);
+    segment.setBodySID(2);
+    segment.setIndexEditRate(editRate);
+    segment.setEditUnitByteCount(100);
+    segment.appendDeltaEntry(0, 0, 0);
+    segment.appendDeltaEntry(0, 0, 40);
+
+    const MXFDeltaEntry *firstEntry = segment.getDeltaEntryAtDelta(0, 0);
+    if (!segment.haveDeltaEntryAtDelta(40, 0) || segment.haveDeltaEntryAtDelta(60, 0) ||
+        segment.haveDeltaEntryAtDelta(0, 1))
+    {
+        throw "Delta entry lookup mismatch";
+    }
+
+    // entries returned by getDeltaEntryAtDelta remain valid after an append
+    segment.appendDeltaEntry(-1, 1, 0);
+    segment.appendDeltaEntry(0, 1, 20);
+    if (segment.getDeltaEntries().size() != 4 || segment.getDeltaEntryAtDelta(0, 0) != firstEntry ||
+        firstEntry->elementData != 0 ||
+        !segment.haveDeltaEntryAtDelta(20, 1) || segment.getDeltaEntryAtDelta(0, 1)->posTableIndex != -1)
+    {
+        throw "Delta entry lookup after append mismatch";
+    }
+
+    auto_ptr<IndexTableSegment> readSegment(writeAndReadIndexSegment(&segment));
+    if (readSegment->getDeltaEntries().size() != 4 ||
+        !readSegment->haveDeltaEntryAtDelta(40, 0) || readSegment->haveDeltaEntryAtDelta(40, 1) ||
+        readSegment->getDeltaEntryAtDelta(0, 1)->posTableIndex != -1 ||
+        readSegment->getDeltaEntryAtDelta(20, 1)->slice != 1)
+    {
+        throw "Delta entry lookup after read mismatch";
+    }
+}
+
+static void testIndexTable()
+{
+    IndexTable indexTable(1);
+
+    vector<uint32_t> sliceOffset;
+    vector<mxfRational> posTable;
+    int i;
+    for (i = 0; i < 2; i++)
+    {
+        IndexTableSegment *segment = new IndexTableSegment();
+        segment->setIndexSID(1);
+        segment->setBodySID(2);
+        segment->setIndexStartPosition(i * 10);
+        segment->setIndexDuration(10);
+        int j;
+        for (j = 0; j < 10; j++)
+            segment->appendIndexEntry(0, 0, 0x80, (i * 10 + j) * 100, sliceOffset, posTable);
+        indexTable.addSegment(segment, 0);
+    }
+
+    IndexTable::Entry entry;
+    if (indexTable.getNumSegments() != 2 || indexTable.getDuration() != 20 ||
+        !indexTable.getEntry(15, &entry) || entry.streamOffset != 1500 ||
+        indexTable.haveEntry(20) || indexTable.haveEntry(-1))
+    {
+        throw "Index table VBR lookup mismatch";
+    }
+
+    IndexTableSegment *segment = new IndexTableSegment();
+    segment->setIndexSID(1);
+    segment->setIndexStartPosition(20);
+    segment->setIndexDuration(0);
+    segment->setEditUnitByteCount(50);
+    indexTable.addSegment(segment, 0);
+    if (!indexTable.getEntry(25, &entry) || entry.streamOffset != 1250)
+        throw "Index table CBR lookup mismatch";
+}
+
+static void checkCompactIndexTable(const CompactIndexTable &compactTable, const vector<uint64_t> &streamOffsets)
+{
+    if (compactTable.getNumEntries() != (int64_t)streamOffsets.size())
+    {
+        throw "Compact index table entry count mismatch";
+    }
+
+    int8_t temporalOffset;
+    int8_t keyFrameOffset;
+    uint8_t flags;
+    uint64_t streamOffset;
+    size_t i;
+    for (i = 0; i < streamOffsets.size(); i++)
+    {
+        if (!compactTable.getEntry((int64_t)i, &temporalOffset, &keyFrameOffset, &flags, &streamOffset) ||
+            streamOffset != streamOffsets[i] || compactTable.getStreamOffset((int64_t)i) != streamOffsets[i] ||
+            temporalOffset != (int8_t)(i % 3 - 1) || keyFrameOffset != (int8_t)(-(int)(i % 12)) ||
+            flags != (i % 12 == 0 ? 0xc0 : 0x22))
+        {
+            throw "Compact index table entry mismatch";
+        }
+    }
+    if (compactTable.getEntry(-1, &temporalOffset, &keyFrameOffset, &flags, &streamOffset) ||
+        compactTable.getEntry((int64_t)streamOffsets.size(), &temporalOffset, &keyFrameOffset, &flags, &streamOffset))
+    {
+        throw "Compact index table returned an entry outside the table";
+    }
+}
+
+static void testCompactIndexTable()
+{
+    // the entry counts are not a multiple of the block size so that the last entries are read from the
+    // pending block
+    vector<uint64_t> streamOffsets;
+    uint32_t i;
+
+    // stream offsets that are not increasing
+    CompactIndexTable unorderedTable;
+    for (i = 0; i < 3 * CompactIndexTable::BLOCK_SIZE + 8; i++)
+    {
+        streamOffsets.push_back((uint64_t)((i * 7919) % 1000) * 100 + i);
+        unorderedTable.appendEntry((int8_t)(i % 3 - 1), (int8_t)(-(int)(i % 12)), (i % 12 == 0 ? 0xc0 : 0x22),
+                                   streamOffsets.back());
+    }
+    checkCompactIndexTable(unorderedTable, streamOffsets);
+
+    // edit units of 4GB or more
+    CompactIndexTable largeTable;
+    streamOffsets.clear();
+    uint64_t streamOffset = 0;
+    for (i = 0; i < 2 * CompactIndexTable::BLOCK_SIZE + 5; i++)
+    {
+        streamOffsets.push_back(streamOffset);
+        largeTable.appendEntry((int8_t)(i % 3 - 1), (int8_t)(-(int)(i % 12)), (i % 12 == 0 ? 0xc0 : 0x22),
+                               streamOffset);
+        streamOffset += ((uint64_t)1 << 32) + (i % 5) * 1000;
+    }
+    checkCompactIndexTable(largeTable, streamOffsets);
+
+    largeTable.shrinkToFit();
+    checkCompactIndexTable(largeTable, streamOffsets);
+}
+
+static void testSeekPlan()
+{
+    // stored order I0 P3 B1 B2 P6 B4 B5. The next GOP's I-frame follows so that the target frame B5 has a size
+    static const int8_t temporalOffsets[] = {0, 1, 1, -2, 1, 1, -2, 0};
+    static const int8_t keyFrameOffsets[] = {0, -1, -2, -3, -4, -5, -6, 0};
+    static const uint8_t flags[] = {0xc0, 0x22, 0x33, 0x33, 0x22, 0x33, 0x33, 0xc0};
+
+    IndexTableSegment *segment = new IndexTableSegment();
+    segment->setIndexSID(1);
+    segment->setIndexDuration(8);
+    vector<uint32_t> sliceOffset;
+    vector<mxfRational> posTable;
+    int i;
+    for (i = 0; i < 8; i++)
+    {
+        segment->appendIndexEntry(temporalOffsets[i], keyFrameOffsets[i], flags[i], i * 100, sliceOffset, posTable);
+    }
+
+    IndexTable indexTable(1);
+    indexTable.addSegment(segment, 0);
+
+    IndexTable::SeekPlan plan;
+    if (!indexTable.planSeek(5, &plan) || plan.targetPosition != 6 || plan.keyFramePosition != 0 ||
+        plan.editUnits.size() != 4 || plan.editUnits[2].position != 4 ||
+        plan.readStreamOffset != 0 || plan.readSize != 700)
+    {
+        throw "Seek plan mismatch";
+    }
+
+    // a corrupt positive key frame offset places the key frame after the target
+    IndexTableSegment *corruptSegment = new IndexTableSegment();
+    corruptSegment->setIndexSID(1);
+    corruptSegment->setIndexDuration(3);
+    for (i = 0; i < 3; i++)
+    {
+        corruptSegment->appendIndexEntry(0, (i == 1 ? 1 : 0), 0xc0, i * 100, sliceOffset, posTable);
+    }
+    IndexTable corruptIndexTable(1);
+    corruptIndexTable.addSegment(corruptSegment, 0);
+    if (corruptIndexTable.planSeek(1, &plan) || !corruptIndexTable.planSeek(2, &plan))
+    {
+        throw "Seek plan with a corrupt key frame offset mismatch";
+    }
+}
+
+static void testStreamingIndex()
+{
+    {
+        auto_ptr<File> file(File::openNew(TEST_INDEX_FILENAME));
+
+        Partition& headerPartition = file->createPartition();
+        headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+        headerPartition.setKagSize(0x100);
+        headerPartition.setBodySID(1);
+        headerPartition.write(file.get());
+
+        mxfRational editRate = {25, 1};
+        StreamingIndexTableWriter indexWriter(2, 1, editRate, 10);
+        int i;
+        for (i = 0; i < 25; i++)
+        {
+            if (indexWriter.isSegmentFull())
+            {
+                Partition &bodyPartition = file->createPartition();
+                bodyPartition.setKey(&MXF_PP_K(ClosedComplete, Body));
+                bodyPartition.write(file.get());
+                indexWriter.writeSegment(file.get(), &bodyPartition);
+            }
+            indexWriter.addIndexEntry(0, 0, 0x80, i * 100);
+        }
+        if (indexWriter.getPendingEntryCount() != 5 || indexWriter.getDuration() != 25)
+            throw "Streaming index writer entry count mismatch";
+
+        Partition &footerPartition = file->createPartition();
+        footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+        footerPartition.setBodySID(0);
+        footerPartition.write(file.get());
+        indexWriter.writeSegment(file.get(), &footerPartition);
+
+        file->writeRIP();
+        file->updatePartitions();
+    }
+
+    auto_ptr<File> file(File::openRead(TEST_INDEX_FILENAME));
+    if (!file->readPartitions())
+        throw "Failed to read partitions";
+
+    IndexTable indexTable(2);
+    indexTable.read(file.get());
+    IndexTable::Entry entry;
+    if (indexTable.getNumSegments() != 3 || indexTable.getDuration() != 25 ||
+        !indexTable.getEntry(24, &entry) || entry.streamOffset != 2400)
+    {
+        throw "Streaming index read back mismatch";
+    }
+
+    // map the segment in the first body partition
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    file->seek(file->getPartitions()[1]->getThisPartition(), SEEK_SET);
+    file->readKL(&key, &llen, &len);
+    file->skip(len);
+    file->readNextNonFillerKL(&key, &llen, &len);
+    auto_ptr<MappedIndexTableSegment> mappedSegment(
+        MappedIndexTableSegment::open(TEST_INDEX_FILENAME, file->tell(), len));
+    if (mappedSegment->getIndexSID() != 2 || mappedSegment->getNumIndexEntries() != 10 ||
+        mappedSegment->getStreamOffset(9) != 900)
+    {
+        throw "Mapped index table segment mismatch";
+    }
+
+    // a segment that extends beyond the end of the file results in an exception
+    bool rejected = false;
+    try
+    {
+        delete MappedIndexTableSegment::open(TEST_INDEX_FILENAME, file->size() - 10, len);
+    }
+    catch (MXFException &ex)
+    {
+        rejected = true;
+    }
+    if (!rejected)
+    {
+        throw "Mapped index table segment beyond the end of the file was accepted";
+    }
+}
+
+
+static void testIndexRecovery()
+{
+    static const mxfKey pictureElementKey =
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01, 0x15, 0x01, 0x05, 0x01};
+    vector<unsigned char> data(200, 0);
+
+    {
+        auto_ptr<File> file(File::openNew(TEST_INDEX_FILENAME));
+        file->setMinLLen(4);
+
+        Partition& headerPartition = file->createPartition();
+        headerPartition.setKey(&MXF_PP_K(OpenIncomplete, Header));
+        headerPartition.setBodySID(1);
+        headerPartition.write(file.get());
+
+        int i;
+        for (i = 0; i < 10; i++)
+        {
+            file->writeFixedKL(&pictureElementKey, 4, data.size() + i);
+            file->write(&data[0], (uint32_t)(data.size() + i));
+        }
+
+        // truncated element
+        file->writeFixedKL(&pictureElementKey, 4, 1000);
+        file->write(&data[0], 10);
+        file->updatePartitions();
+    }
+
+    IndexRecovery recovery(TEST_INDEX_FILENAME);
+    recovery.setChunkSize(256);
+    recovery.setNumThreads(4);
+    recovery.scan();
+    if (!recovery.isTruncated() || recovery.getEditUnitOffsets().size() != 10 ||
+        recovery.getEditUnitOffsets()[2] != 2 * (mxfKey_extlen + 4 + data.size()) + 1)
+    {
+        throw "Index recovery edit unit mismatch";
+    }
+
+    {
+        mxfRational editRate = {25, 1};
+        auto_ptr<IndexTableSegment> segment(recovery.createIndexTableSegment(2, 1, editRate));
+        auto_ptr<File> file(File::openModify(TEST_INDEX_FILENAME));
+        recovery.writeIndex(file.get(), segment.get());
+    }
+
+    auto_ptr<File> file(File::openRead(TEST_INDEX_FILENAME));
+    if (!file->readPartitions())
+        throw "Failed to read partitions of recovered file";
+    IndexTable indexTable(2);
+    indexTable.read(file.get());
+    IndexTable::Entry entry;
+    if (indexTable.getDuration() != 10 || !indexTable.getEntry(9, &entry) ||
+        entry.streamOffset != recovery.getEditUnitOffsets()[9])
+    {
+        throw "Recovered index read back mismatch";
+    }
+
+    IndexVerifier verifier(TEST_INDEX_FILENAME);
+    verifier.setNumThreads(2);
+    if (!verifier.verify(2) || verifier.getNumEditUnits() != 10 || verifier.isClipWrapped())
+        throw "Recovered index verification failed";
+}
+
+
+// writes a header partition containing 10 frame wrapped edit units, each a 120 byte picture element
+// followed by a 40 byte sound element, and returns a footer partition with IndexSID 2
+static Partition& writeFrameWrappedEssence(File *file)
+{
+    static const mxfKey pictureElementKey =
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01, 0x15, 0x01, 0x05, 0x01};
+    static const mxfKey soundElementKey =
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01, 0x16, 0x01, 0x01, 0x01};
+    vector<unsigned char> data(100, 0);
+
+    file->setMinLLen(4);
+
+    Partition& headerPartition = file->createPartition();
+    headerPartition.setKey(&MXF_PP_K(ClosedComplete, Header));
+    headerPartition.setBodySID(1);
+    headerPartition.write(file);
+
+    int i;
+    for (i = 0; i < 10; i++)
+    {
+        file->writeFixedKL(&pictureElementKey, 4, 100);
+        file->write(&data[0], 100);
+        file->writeFixedKL(&soundElementKey, 4, 20);
+        file->write(&data[0], 20);
+    }
+
+    Partition &footerPartition = file->createPartition();
+    footerPartition.setKey(&MXF_PP_K(ClosedComplete, Footer));
+    footerPartition.setIndexSID(2);
+    footerPartition.setBodySID(0);
+    footerPartition.write(file);
+
+    return footerPartition;
+}
+
+static void testIndexVerifierMismatches()
+{
+    uint64_t editUnitSize = 2 * (mxfKey_extlen + 4) + 100 + 20;
+
+    {
+        auto_ptr<File> file(File::openNew(TEST_INDEX_FILENAME));
+        Partition &footerPartition = writeFrameWrappedEssence(file.get());
+
+        // the first segment has a stream offset that is not at an edit unit and the second segment
+        // has a sound element delta entry that is not at the sound element
+        mxfRational editRate = {25, 1};
+        vector<uint32_t> sliceOffset;
+        vector<mxfRational> posTable;
+        int s;
+        for (s = 0; s < 2; s++)
+        {
+            IndexTableSegment segment;
+            segment.setIndexSID(2);
+            segment.setBodySID(1);
+            segment.setIndexEditRate(editRate);
+            segment.setIndexStartPosition(s * 5);
+            segment.setIndexDuration(5);
+            segment.appendDeltaEntry(0, 0, 0);
+            segment.appendDeltaEntry(0, 0, (s == 0 ? 120 : 100));
+            int i;
+            for (i = s * 5; i < s * 5 + 5; i++)
+            {
+                segment.appendIndexEntry(0, 0, 0x80, i * editUnitSize + (i == 2 ? 8 : 0),
+                                         sliceOffset, posTable);
+            }
+            segment.write(file.get(), &footerPartition, 0);
+        }
+
+        file->writeRIP();
+        file->updatePartitions();
+    }
+
+    IndexVerifier verifier(TEST_INDEX_FILENAME);
+    verifier.setNumThreads(2);
+    verifier.setMaxMismatches(0);
+    if (verifier.verify(2) || verifier.getNumEditUnits() != 10 || verifier.isClipWrapped())
+        throw "Index verification of corrupted index succeeded";
+
+    // edit unit 1 ends at the corrupted stream offset of edit unit 2 and edit units 5 to 9
+    // are in the segment with the corrupted delta entry
+    const vector<IndexVerifier::Mismatch> &mismatches = verifier.getMismatches();
+    if (mismatches.size() != 7 ||
+        mismatches[0].position != 1 || mismatches[0].type != IndexVerifier::EDIT_UNIT_SIZE_MISMATCH ||
+        mismatches[1].position != 2 || mismatches[1].streamOffset != 2 * editUnitSize + 8 ||
+        (mismatches[1].type != IndexVerifier::NO_KLV_AT_OFFSET &&
+            mismatches[1].type != IndexVerifier::EDIT_UNIT_KEY_MISMATCH))
+    {
+        throw "Index verification stream offset mismatch";
+    }
+    size_t i;
+    for (i = 2; i < mismatches.size(); i++)
+    {
+        if (mismatches[i].position != (int64_t)(i + 3) ||
+            mismatches[i].type != IndexVerifier::DELTA_ENTRY_MISMATCH)
+        {
+            throw "Index verification delta entry mismatch";
+        }
+    }
+
+    IndexVerifier limitedVerifier(TEST_INDEX_FILENAME);
+    limitedVerifier.setNumThreads(1);
+    limitedVerifier.setMaxMismatches(1);
+    if (limitedVerifier.verify(2) || limitedVerifier.getMismatches().size() != 1)
+        throw "Index verification mismatch limit failed";
+}
+
+
+static void testIndexVerifierCBR()
+{
+    {
+        auto_ptr<File> file(File::openNew(TEST_INDEX_FILENAME));
+        Partition &footerPartition = writeFrameWrappedEssence(file.get());
+
+        // a CBR segment with a zero IndexDuration covers all the essence
+        mxfRational editRate = {25, 1};
+        IndexTableSegment segment;
+        segment.setIndexSID(2);
+        segment.setBodySID(1);
+        segment.setIndexEditRate(editRate);
+        segment.setIndexStartPosition(0);
+        segment.setIndexDuration(0);
+        segment.setEditUnitByteCount(2 * (mxfKey_extlen + 4) + 100 + 20);
+        segment.appendDeltaEntry(0, 0, 0);
+        segment.appendDeltaEntry(0, 0, 120);
+        segment.write(file.get(), &footerPartition, 0);
+
+        file->writeRIP();
+        file->updatePartitions();
+    }
+
+    // the edit unit count is calculated from all the essence in the partition and not the first element
+    IndexVerifier verifier(TEST_INDEX_FILENAME);
+    verifier.setNumThreads(2);
+    if (!verifier.verify(2) || verifier.getNumEditUnits() != 10 || verifier.isClipWrapped())
+        throw "CBR index verification failed";
+}
 
 
 int main(int argc, const char **argv)
@@ -190,6 +1398,49 @@ int main(int argc, const char **argv)
         testRead(TEST_WRITE_FILENAME);
         printf("Done testing reading\n");
 
+        printf("Testing parallel reading...\n");
+        testParallelRead(TEST_WRITE_FILENAME, 0);
+        testWriteLargeHeader();
+        // more sets than the minimum for which HeaderMetadata::readParallel uses multiple threads
+        testParallelRead(TEST_LARGE_HEADER_FILENAME, 2000);
+        testArenaHeaderMetadata();
+        printf("Done testing parallel reading\n");
+
+        printf("Testing header metadata write cache...\n");
+        testWriteCache();
+        testPatchItems();
+        testHeaderTemplate();
+        printf("Done testing header metadata write cache\n");
+
+        printf("Testing sequence component index...\n");
+        testSequenceIndex();
+        printf("Done testing sequence component index\n");
+
+        printf("Testing package graph...\n");
+        testPackageGraph();
+        printf("Done testing package graph\n");
+
+        printf("Testing index table...\n");
+        testIndexSegmentRoundTrip();
+        testDeltaEntryLookup();
+        testIndexTable();
+        testSeekPlan();
+        testCompactIndexTable();
+        printf("Done testing index table\n");
+
+        printf("Testing streaming index writer...\n");
+        testStreamingIndex();
+        printf("Done testing streaming index writer\n");
+
+        printf("Testing index recovery...\n");
+        testIndexRecovery();
+        testIndexVerifierMismatches();
+        testIndexVerifierCBR();
+        printf("Done testing index recovery\n");
+
+        remove(TEST_HEADER_FILENAME);
+        remove(TEST_LARGE_HEADER_FILENAME);
+        remove(TEST_INDEX_FILENAME);
         remove(TEST_WRITE_FILENAME);
     }
     catch (MXFException &ex)
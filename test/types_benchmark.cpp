@@ -0,0 +1,132 @@
+/*
+ * Benchmark the libMXF++ identifier comparison and hashing
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libMXF++/MXF.h>
+#include <chrono>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+using namespace mxfpp;
+
+
+#define NUM_IDS         100000
+#define NUM_ROUNDS      10
+
+
+struct MemcmpLess
+{
+    bool operator()(const mxfUUID &left, const mxfUUID &right) const
+    {
+        return memcmp(&left, &right, sizeof(left)) < 0;
+    }
+};
+
+
+
+static double elapsed_ns(chrono::steady_clock::time_point start)
+{
+    return (double)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+}
+
+template <class M>
+static void benchmarkLookup(const char *name, const vector<mxfUUID> &ids)
+{
+    M directory;
+    size_t i;
+    for (i = 0; i < ids.size(); i++)
+        directory[ids[i]] = (int)i;
+
+    size_t found = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int r;
+    for (r = 0; r < NUM_ROUNDS; r++) {
+        for (i = 0; i < ids.size(); i++)
+            found += directory.count(ids[ids.size() - 1 - i]);
+    }
+    double ns = elapsed_ns(start);
+
+    printf("%-40s %8.1f ns/lookup (%u found)\n", name, ns / ((double)NUM_ROUNDS * ids.size()), (unsigned int)found);
+}
+
+int main()
+{
+    // UUIDs differing in the last bytes only, like keys and labels with a common prefix
+    vector<mxfUUID> ids(NUM_IDS);
+    size_t i;
+    for (i = 0; i < ids.size(); i++) {
+        memset(&ids[i], 0x06, sizeof(ids[i]));
+        ids[i].octet12 = (uint8_t)(rand() & 0xff);
+        ids[i].octet13 = (uint8_t)(rand() & 0xff);
+        ids[i].octet14 = (uint8_t)(i >> 8);
+        ids[i].octet15 = (uint8_t)i;
+    }
+
+    size_t equalCount = 0;
+    int lessCount = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (i = 1; i < ids.size(); i++) {
+        equalCount += (memcmp(&ids[i - 1], &ids[i], sizeof(ids[i])) == 0);
+        lessCount += (memcmp(&ids[i - 1], &ids[i], sizeof(ids[i])) < 0);
+    }
+    double memcmpNs = elapsed_ns(start);
+
+    size_t fastEqualCount = 0;
+    int fastLessCount = 0;
+    start = chrono::steady_clock::now();
+    for (i = 1; i < ids.size(); i++) {
+        fastEqualCount += (ids[i - 1] == ids[i]);
+        fastLessCount += (ids[i - 1] < ids[i]);
+    }
+    double fastNs = elapsed_ns(start);
+
+    if (equalCount != fastEqualCount || lessCount != fastLessCount) {
+        fprintf(stderr, "Comparison results differ from memcmp\n");
+        return 1;
+    }
+
+    printf("%-40s %8.2f ns/compare\n", "memcmp ==, <", memcmpNs / (ids.size() - 1));
+    printf("%-40s %8.2f ns/compare\n", "mxfUUID ==, <", fastNs / (ids.size() - 1));
+
+    benchmarkLookup<map<mxfUUID, int, MemcmpLess> >("std::map (memcmp)", ids);
+    benchmarkLookup<map<mxfUUID, int> >("std::map (mxfUUID <)", ids);
+    benchmarkLookup<unordered_map<mxfUUID, int> >("std::unordered_map (hash<mxfUUID>)", ids);
+
+    return 0;
+}
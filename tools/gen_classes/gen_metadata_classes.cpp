@@ -54,8 +54,12 @@
 typedef struct
 {
     FILE *baseHeaderFile;
+    FILE *kindHeaderFile;
+    FILE *visitorHeaderFile;
+    FILE *visitorSourceFile;
     const char *directory;
     MXFDataModel *dataModel;
+    int numSetKinds;
 } SetDefsData;
 
 
@@ -262,6 +266,25 @@ static const char* get_type_name(MXFDataModel *dataModel, MXFItemDef *itemDef,
     return typeName;
 }
 
+static int have_item_value_traits(const char *typeName)
+{
+    static const char *fixedSizeTypeNames[] =
+    {
+        "int8_t", "int16_t", "int32_t", "int64_t",
+        "uint8_t", "uint16_t", "uint32_t", "uint64_t",
+        "bool", "mxfRational", "mxfTimestamp", "mxfUUID", "mxfUL", "mxfUMID",
+    };
+    size_t i;
+
+    for (i = 0; i < ARRAY_SIZE(fixedSizeTypeNames); i++)
+    {
+        if (strcmp(typeName, fixedSizeTypeNames[i]) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
 static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef *setDef)
 {
     FILE *baseSourceFile;
@@ -408,6 +431,7 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
         "public:\n"
         "    friend class MetadataSetFactory<%s>;\n"
         "    static const mxfKey setKey;\n"
+        "    static const MetadataSetKind SET_KIND = %s_SET_KIND;\n"
         "\n"
         "public:\n"
         "    %s(HeaderMetadata *headerMetadata);\n"
@@ -420,6 +444,7 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
         (setDef->parentSetDef != NULL) ? parentClassName : "MetadataSet",
         baseClassName, parentClassName,
         baseClassName,
+        classNameU,
         baseClassName,
         baseClassName);
 
@@ -606,11 +631,15 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
         "\n"
         "%s::%s(HeaderMetadata *headerMetadata)\n"
         ": %s(headerMetadata)\n"
-        "{}\n"
+        "{\n"
+        "    setSetKind(%s_SET_KIND);\n"
+        "}\n"
         "\n"
         "%s::%s(HeaderMetadata *headerMetadata, ::MXFMetadataSet *cMetadataSet)\n"
         ": %s(headerMetadata, cMetadataSet)\n"
-        "{}\n"
+        "{\n"
+        "    setSetKind(%s_SET_KIND);\n"
+        "}\n"
         "\n"
         "%s::~%s()\n"
         "{}\n"
@@ -618,8 +647,10 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
         "\n",
         className, className,
         baseClassName,
+        classNameU,
         className, className,
         baseClassName,
+        classNameU,
         className, className
         );
 
@@ -1000,30 +1031,16 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
                             c = elementTypeName[strlen(elementTypeName) - 1];
                             elementTypeName[strlen(elementTypeName) - 1] = '\0';
                             fprintf(baseSourceFile,
-                                "    vector<%s*> result;\n"
-                                "    auto_ptr<ObjectIterator> iter(getStrongRefArrayItem(&MXF_ITEM_K(%s, %s)));\n"
-                                "    while (iter->next())\n"
-                                "    {\n"
-                                "        MXFPP_CHECK(dynamic_cast<%s*>(iter->get()) != 0);\n"
-                                "        result.push_back(dynamic_cast<%s*>(iter->get()));\n"
-                                "    }\n"
-                                "    return result;\n",
-                                elementTypeName, className, itemName, elementTypeName, elementTypeName);
+                                "    return getRefArrayItemSets<%s>(&MXF_ITEM_K(%s, %s));\n",
+                                elementTypeName, className, itemName);
                             elementTypeName[strlen(elementTypeName) - 1] = c;
                             break;
                         case MXF_WEAKREF_TYPE:
                             c = elementTypeName[strlen(elementTypeName) - 1];
                             elementTypeName[strlen(elementTypeName) - 1] = '\0';
                             fprintf(baseSourceFile,
-                                "    vector<%s*> result;\n"
-                                "    auto_ptr<ObjectIterator> iter(getWeakRefArrayItem(&MXF_ITEM_K(%s, %s)));\n"
-                                "    while (iter->next())\n"
-                                "    {\n"
-                                "        MXFPP_CHECK(dynamic_cast<%s*>(iter->get()) != 0);\n"
-                                "        result.push_back(dynamic_cast<%s*>(iter->get()));\n"
-                                "    }\n"
-                                "    return result;\n",
-                                elementTypeName, className, itemName, elementTypeName, elementTypeName);
+                                "    return getRefArrayItemSets<%s>(&MXF_ITEM_K(%s, %s));\n",
+                                elementTypeName, className, itemName);
                             elementTypeName[strlen(elementTypeName) - 1] = c;
                             break;
                         case MXF_ORIENTATION_TYPE:
@@ -1935,6 +1952,49 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
     }
 
 
+    /* header item descriptors */
+
+    i = 0;
+    mxf_initialise_list_iter(&itemIter, &setDef->itemDefs);
+    while (mxf_next_list_iter_element(&itemIter))
+    {
+        MXFItemDef *itemDef = (MXFItemDef*)mxf_get_iter_element(&itemIter);
+        MXFItemType *itemType = mxf_get_item_def_type(dataModel, itemDef->typeId);
+        CHECK(itemType != NULL);
+
+        if (itemType->category != MXF_BASIC_TYPE_CAT &&
+            itemType->category != MXF_INTERPRET_TYPE_CAT &&
+            itemType->category != MXF_COMPOUND_TYPE_CAT)
+        {
+            continue;
+        }
+        get_type_name(dataModel, itemDef, itemType, typeName);
+        if (!have_item_value_traits(typeName))
+        {
+            continue;
+        }
+
+        strcpy(itemName, itemDef->name);
+        itemName[0] = toupper(itemName[0]);
+
+        if (i == 0)
+        {
+            fprintf(baseHeaderFile,
+                "\n"
+                "\n"
+                "   // item descriptors\n"
+                "\n");
+        }
+        i++;
+
+        fprintf(baseHeaderFile,
+            "   struct %sItem : ItemDescriptor<%s, 0x%04x>\n"
+            "   { static const mxfKey* key() { return &MXF_ITEM_K(%s, %s); } };\n",
+            itemName, typeName, itemDef->localTag,
+            className, itemName);
+    }
+
+
     /* header footer */
 
     fprintf(baseHeaderFile,
@@ -1973,11 +2033,67 @@ static void gen_class(const char *directory, MXFDataModel *dataModel, MXFSetDef
     fclose(headerFile);
 }
 
+static void print_license(FILE *file)
+{
+    fprintf(file,
+        "/*\n"
+        " * Copyright (C) 2008, British Broadcasting Corporation\n"
+        " * All Rights Reserved.\n"
+        " *\n"
+        " * Author: Philip de Nier\n"
+        " *\n"
+        " * Redistribution and use in source and binary forms, with or without\n"
+        " * modification, are permitted provided that the following conditions are met:\n"
+        " *\n"
+        " *     * Redistributions of source code must retain the above copyright notice,\n"
+        " *       this list of conditions and the following disclaimer.\n"
+        " *     * Redistributions in binary form must reproduce the above copyright\n"
+        " *       notice, this list of conditions and the following disclaimer in the\n"
+        " *       documentation and/or other materials provided with the distribution.\n"
+        " *     * Neither the name of the British Broadcasting Corporation nor the names\n"
+        " *       of its contributors may be used to endorse or promote products derived\n"
+        " *       from this software without specific prior written permission.\n"
+        " *\n"
+        " * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\"\n"
+        " * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE\n"
+        " * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE\n"
+        " * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE\n"
+        " * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR\n"
+        " * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF\n"
+        " * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS\n"
+        " * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN\n"
+        " * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)\n"
+        " * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE\n"
+        " * POSSIBILITY OF SUCH DAMAGE.\n"
+        " */\n"
+        "\n");
+}
+
+static FILE* open_file(const char *directory, const char *name)
+{
+    char filename[FILENAME_MAX];
+    FILE *file;
+
+    strcpy(filename, directory);
+    strcat(filename, "/");
+    strcat(filename, name);
+    if ((file = fopen(filename, "wb")) == NULL)
+    {
+        perror("fopen");
+        exit(1);
+    }
+
+    return file;
+}
+
 static int process_set_defs(void *setDefIn, void *dataIn)
 {
     MXFSetDef *setDef = (MXFSetDef*)setDefIn;
     SetDefsData *data = (SetDefsData*)dataIn;
     char className[256];
+    char classNameU[256];
+    char parentClassName[256];
+    int i;
 
     if (mxf_equals_key(&setDef->key, &g_Null_Key))
     {
@@ -1987,12 +2103,43 @@ static int process_set_defs(void *setDefIn, void *dataIn)
 
     strcpy(className, setDef->name);
     className[0] = toupper(className[0]);
+    strcpy(classNameU, setDef->name);
+    for (i = 0; i < (int)strlen(classNameU); i++)
+    {
+        classNameU[i] = toupper(classNameU[i]);
+    }
+    if (setDef->parentSetDef == NULL || mxf_equals_key(&setDef->parentSetDef->key, &g_Null_Key))
+    {
+        strcpy(parentClassName, "MetadataSet");
+    }
+    else
+    {
+        strcpy(parentClassName, setDef->parentSetDef->name);
+        parentClassName[0] = toupper(parentClassName[0]);
+    }
 
     /* include */
     fprintf(data->baseHeaderFile,
         "#include <libMXF++/metadata/%s.h>\n",
         className);
 
+    /* set kind and visitor */
+    fprintf(data->kindHeaderFile,
+        "    %s_SET_KIND,\n",
+        classNameU);
+    data->numSetKinds++;
+
+    fprintf(data->visitorHeaderFile,
+        "    virtual void visit(%s *set) { visit(static_cast<%s*>(set)); }\n",
+        className, parentClassName);
+
+    fprintf(data->visitorSourceFile,
+        "        case %s_SET_KIND:\n"
+        "            visit(static_cast<%s*>(set));\n"
+        "            break;\n",
+        classNameU,
+        className);
+
 
     gen_class(data->directory, data->dataModel, setDef);
 
@@ -2012,6 +2159,9 @@ int main(int argc, const char** argv)
     MXFDataModel *dataModel;
     char mkdirCmd[FILENAME_MAX];
     FILE *baseHeaderFile;
+    FILE *kindHeaderFile;
+    FILE *visitorHeaderFile;
+    FILE *visitorSourceFile;
     char filename[FILENAME_MAX];
     const char *directory;
     SetDefsData setDefsData;
@@ -2090,11 +2240,87 @@ int main(int argc, const char** argv)
         "\n"
         "\n");
 
+    /* set kind and visitor headers */
+
+    kindHeaderFile = open_file(directory, "MetadataSetKind.h");
+    print_license(kindHeaderFile);
+    fprintf(kindHeaderFile,
+        "#ifndef MXFPP_METADATA_SET_KIND_H_\n"
+        "#define MXFPP_METADATA_SET_KIND_H_\n"
+        "\n"
+        "\n"
+        "\n"
+        "namespace mxfpp\n"
+        "{\n"
+        "\n"
+        "\n"
+        "// the generated class of a metadata set. A set's kind mask has a bit set for its kind and the kind of\n"
+        "// each of its parent classes\n"
+        "\n"
+        "enum MetadataSetKind\n"
+        "{\n"
+        "    UNKNOWN_SET_KIND = 0,\n");
+
+    visitorHeaderFile = open_file(directory, "MetadataSetVisitor.h");
+    print_license(visitorHeaderFile);
+    fprintf(visitorHeaderFile,
+        "#ifndef MXFPP_METADATA_SET_VISITOR_H_\n"
+        "#define MXFPP_METADATA_SET_VISITOR_H_\n"
+        "\n"
+        "\n"
+        "\n"
+        "#include <libMXF++/metadata/Metadata.h>\n"
+        "\n"
+        "\n"
+        "namespace mxfpp\n"
+        "{\n"
+        "\n"
+        "\n"
+        "// dispatch() calls the visit function for the set's kind. The default visit functions call the visit\n"
+        "// function for the parent class\n"
+        "\n"
+        "class MetadataSetVisitor\n"
+        "{\n"
+        "public:\n"
+        "    virtual ~MetadataSetVisitor() {}\n"
+        "\n"
+        "    void dispatch(MetadataSet *set);\n"
+        "\n"
+        "    virtual void visit(MetadataSet *set) { (void)set; }\n");
+
+    visitorSourceFile = open_file(directory, "MetadataSetVisitor.cpp");
+    print_license(visitorSourceFile);
+    fprintf(visitorSourceFile,
+        "#ifdef HAVE_CONFIG_H\n"
+        "#include \"config.h\"\n"
+        "#endif\n"
+        "\n"
+        "#include <libMXF++/MXF.h>\n"
+        "\n"
+        "\n"
+        "using namespace std;\n"
+        "using namespace mxfpp;\n"
+        "\n"
+        "\n"
+        "\n"
+        "void MetadataSetVisitor::dispatch(MetadataSet *set)\n"
+        "{\n"
+        "    switch (set->getSetKind())\n"
+        "    {\n");
+
+
     setDefsData.baseHeaderFile = baseHeaderFile;
+    setDefsData.kindHeaderFile = kindHeaderFile;
+    setDefsData.visitorHeaderFile = visitorHeaderFile;
+    setDefsData.visitorSourceFile = visitorSourceFile;
     setDefsData.directory = directory;
     setDefsData.dataModel = dataModel;
+    setDefsData.numSetKinds = 0;
     mxf_tree_traverse(&dataModel->setDefs, process_set_defs, &setDefsData);
 
+    /* the kind mask is 64-bit */
+    CHECK(setDefsData.numSetKinds < 64);
+
 
     /* footer */
 
@@ -2105,6 +2331,40 @@ int main(int argc, const char** argv)
 
     fclose(baseHeaderFile);
 
+    fprintf(kindHeaderFile,
+        "\n"
+        "    NUM_SET_KINDS\n"
+        "};\n"
+        "\n"
+        "\n"
+        "};\n"
+        "\n"
+        "\n"
+        "#endif\n");
+
+    fclose(kindHeaderFile);
+
+    fprintf(visitorHeaderFile,
+        "};\n"
+        "\n"
+        "\n"
+        "};\n"
+        "\n"
+        "\n"
+        "#endif\n");
+
+    fclose(visitorHeaderFile);
+
+    fprintf(visitorSourceFile,
+        "        default:\n"
+        "            visit(set);\n"
+        "            break;\n"
+        "    }\n"
+        "}\n"
+        "\n");
+
+    fclose(visitorSourceFile);
+
     mxf_free_data_model(&dataModel);
 
     return 0;
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <libMXF++/MXF.h>
+
+using namespace std;
+using namespace mxfpp;
+
+
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s [options] <filename>\n", cmd);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h | --help           Show this usage message and exit\n");
+    fprintf(stderr, "  -t <count>            Number of verification threads. Default is the hardware thread count\n");
+    fprintf(stderr, "  -s <sid>              IndexSID of the index table. Default is the first IndexSID found\n");
+    fprintf(stderr, "  -m <count>            Maximum number of mismatches reported per thread. 0 is unlimited. Default 1000\n");
+}
+
+int main(int argc, const char **argv)
+{
+    unsigned int num_threads = 0;
+    unsigned int index_sid = 0;
+    unsigned int max_mismatches = 1000;
+    const char *filename = 0;
+    int cmdln_index;
+
+    for (cmdln_index = 1; cmdln_index < argc; cmdln_index++) {
+        if (strcmp(argv[cmdln_index], "-h") == 0 || strcmp(argv[cmdln_index], "--help") == 0) {
+            usage(argv[0]);
+            return 0;
+        } else if (strcmp(argv[cmdln_index], "-t") == 0 ||
+                   strcmp(argv[cmdln_index], "-s") == 0 ||
+                   strcmp(argv[cmdln_index], "-m") == 0)
+        {
+            unsigned int value;
+            if (cmdln_index + 1 >= argc || sscanf(argv[cmdln_index + 1], "%u", &value) != 1) {
+                usage(argv[0]);
+                fprintf(stderr, "Missing or invalid argument for option '%s'\n", argv[cmdln_index]);
+                return 2;
+            }
+            if (argv[cmdln_index][1] == 't')
+                num_threads = value;
+            else if (argv[cmdln_index][1] == 's')
+                index_sid = value;
+            else
+                max_mismatches = value;
+            cmdln_index++;
+        } else if (cmdln_index + 1 == argc) {
+            filename = argv[cmdln_index];
+        } else {
+            usage(argv[0]);
+            fprintf(stderr, "Unknown option '%s'\n", argv[cmdln_index]);
+            return 2;
+        }
+    }
+    if (!filename) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    IndexVerifier verifier(filename);
+    verifier.setNumThreads(num_threads);
+    verifier.setMaxMismatches(max_mismatches);
+
+    bool result;
+    try
+    {
+        result = verifier.verify(index_sid);
+    }
+    catch (const MXFException &ex)
+    {
+        fprintf(stderr, "Failed to verify index: %s\n", ex.getMessage().c_str());
+        return 2;
+    }
+
+    const vector<IndexVerifier::Mismatch> &mismatches = verifier.getMismatches();
+    size_t i;
+    for (i = 0; i < mismatches.size(); i++) {
+        printf("position %" PRId64 ": %s (stream offset %" PRIu64 ", file position %" PRId64 ")\n",
+               mismatches[i].position, IndexVerifier::getMismatchTypeString(mismatches[i].type),
+               mismatches[i].streamOffset, mismatches[i].filePosition);
+    }
+
+    printf("IndexSID:        %u\n", verifier.getIndexSID());
+    printf("Wrapping:        %s\n", verifier.isClipWrapped() ? "clip" : "frame");
+    printf("Edit units:      %" PRId64 "\n", verifier.getNumEditUnits());
+    printf("Mismatches:      %" PRIszt "\n", mismatches.size());
+    printf("Index read time: %.3f s\n", verifier.getIndexReadTime());
+    printf("Verify time:     %.3f s", verifier.getVerifyTime());
+    if (verifier.getVerifyTime() > 0.0)
+        printf(" (%.0f edit units/s)", verifier.getNumEditUnits() / verifier.getVerifyTime());
+    printf("\n");
+
+    return result ? 0 : 1;
+}
+